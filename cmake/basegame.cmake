@@ -25,6 +25,9 @@ file(GLOB_RECURSE GAME_SOURCES
 	${SOURCE_DIR}/parser/parsetree.cpp
 )
 
+# Unit tests are separate executables
+list(FILTER GAME_SOURCES EXCLUDE REGEX "/tests/")
+
 # Compile lexer and grammar files
 
 if (FLEX_FOUND)
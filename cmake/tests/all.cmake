@@ -1,3 +1,10 @@
 enable_testing()
 
 include(tests/lz77)
+include(tests/con_heap)
+include(tests/con_set)
+include(tests/con_pagedarray)
+include(tests/con_strpool)
+include(tests/scriptvariable_ops)
+include(tests/scriptvariable_share)
+include(tests/scriptcompiler)
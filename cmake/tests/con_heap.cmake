@@ -0,0 +1,13 @@
+#
+# Unit tests
+#
+
+add_executable(test_con_heap
+    ${SOURCE_DIR}/corepp/tests/test_con_heap.cpp
+    ${SOURCE_DIR}/qcommon/q_shared.c
+    ${SOURCE_DIR}/qcommon/common_light.c
+)
+
+target_link_libraries(test_con_heap INTERFACE testing)
+add_test(NAME test_con_heap COMMAND test_con_heap)
+set_tests_properties(test_con_heap PROPERTIES TIMEOUT 15)
@@ -0,0 +1,11 @@
+#
+# Unit tests
+#
+
+add_executable(test_con_pagedarray
+    ${SOURCE_DIR}/corepp/tests/test_con_pagedarray.cpp
+)
+
+target_link_libraries(test_con_pagedarray INTERFACE testing)
+add_test(NAME test_con_pagedarray COMMAND test_con_pagedarray)
+set_tests_properties(test_con_pagedarray PROPERTIES TIMEOUT 15)
@@ -0,0 +1,14 @@
+#
+# Unit tests
+#
+
+add_executable(test_con_set
+    ${SOURCE_DIR}/corepp/tests/test_con_set.cpp
+    ${SOURCE_DIR}/corepp/mem_blockalloc.cpp
+    ${SOURCE_DIR}/qcommon/q_shared.c
+    ${SOURCE_DIR}/qcommon/common_light.c
+)
+
+target_link_libraries(test_con_set INTERFACE testing)
+add_test(NAME test_con_set COMMAND test_con_set)
+set_tests_properties(test_con_set PROPERTIES TIMEOUT 15)
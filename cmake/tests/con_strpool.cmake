@@ -0,0 +1,12 @@
+add_executable(test_con_strpool
+    ${SOURCE_DIR}/corepp/tests/test_con_strpool.cpp
+    ${SOURCE_DIR}/corepp/con_set.cpp
+    ${SOURCE_DIR}/corepp/str.cpp
+    ${SOURCE_DIR}/corepp/mem_blockalloc.cpp
+    ${SOURCE_DIR}/qcommon/q_shared.c
+    ${SOURCE_DIR}/qcommon/common_light.c
+)
+
+target_link_libraries(test_con_strpool INTERFACE testing)
+add_test(NAME test_con_strpool COMMAND test_con_strpool)
+set_tests_properties(test_con_strpool PROPERTIES TIMEOUT 15)
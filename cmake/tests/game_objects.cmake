@@ -0,0 +1,46 @@
+#
+# Game module code linked into the unit tests that need the game (compiler, archives)
+#
+
+if (TARGET test_game_objects)
+    return()
+endif()
+
+include(shared_script)
+include(libraries/flex_bison)
+
+if (NOT TARGET Detour)
+    include(libraries/recastnavigation)
+endif()
+
+file(GLOB_RECURSE TEST_GAME_SOURCES
+    ${SOURCE_DIR}/fgame/*.c ${SOURCE_DIR}/fgame/*.cpp
+    ${SOURCE_DIR}/script/*.c ${SOURCE_DIR}/script/*.cpp
+    ${SOURCE_DIR}/parser/parsetree.cpp
+)
+
+list(FILTER TEST_GAME_SOURCES EXCLUDE REGEX "/tests/")
+
+# Same outputs as the game module
+if (NOT DEFINED FLEX_fgame-lexer_OUTPUTS)
+    flex_target(fgame-lexer ${SOURCE_DIR}/parser/lex_source.txt ${SOURCE_DIR}/parser/generated/yyLexer.cpp DEFINES_FILE ${SOURCE_DIR}/parser/generated/yyLexer.h COMPILE_FLAGS "-Cem --nounistd")
+endif()
+
+if (NOT DEFINED BISON_fgame-parser_OUTPUTS)
+    bison_target(fgame-parser ${SOURCE_DIR}/parser/bison_source.txt ${SOURCE_DIR}/parser/generated/yyParser.cpp)
+endif()
+
+file(MAKE_DIRECTORY "${SOURCE_DIR}/parser/generated")
+
+add_library(test_game_objects OBJECT
+    ${TEST_GAME_SOURCES}
+    ${BISON_fgame-parser_OUTPUTS}
+    ${FLEX_fgame-lexer_OUTPUTS}
+    ${SOURCE_DIR}/qcommon/q_math.c
+    ${SOURCE_DIR}/qcommon/q_shared.c
+    ${SCRIPT_SYSTEM_SOURCES}
+)
+
+target_include_directories(test_game_objects PUBLIC ${SOURCE_DIR}/qcommon ${SOURCE_DIR}/script)
+target_compile_definitions(test_game_objects PUBLIC GAME_DLL WITH_SCRIPT_ENGINE ARCHIVE_SUPPORTED)
+target_link_libraries(test_game_objects PUBLIC Detour DetourCrowd Recast ${COMMON_LIBRARIES})
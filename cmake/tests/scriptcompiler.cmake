@@ -0,0 +1,14 @@
+#
+# Unit tests
+#
+
+include(tests/game_objects)
+
+add_executable(test_scriptcompiler
+    ${SOURCE_DIR}/script/tests/test_scriptcompiler.cpp
+)
+
+target_link_libraries(test_scriptcompiler PRIVATE test_game_objects)
+target_link_libraries(test_scriptcompiler INTERFACE testing)
+add_test(NAME test_scriptcompiler COMMAND test_scriptcompiler)
+set_tests_properties(test_scriptcompiler PROPERTIES TIMEOUT 15)
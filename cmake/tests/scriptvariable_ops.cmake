@@ -0,0 +1,18 @@
+#
+# Unit tests
+#
+
+include(shared_script)
+
+add_executable(test_scriptvariable_ops
+    ${SOURCE_DIR}/script/tests/test_scriptvariable_ops.cpp
+    ${SCRIPT_SYSTEM_SOURCES}
+    ${SOURCE_DIR}/qcommon/q_shared.c
+    ${SOURCE_DIR}/qcommon/common_light.c
+    ${SOURCE_DIR}/null/null_client.c
+)
+
+target_include_directories(test_scriptvariable_ops PRIVATE ${SOURCE_DIR}/qcommon ${SOURCE_DIR}/script)
+target_link_libraries(test_scriptvariable_ops INTERFACE testing)
+add_test(NAME test_scriptvariable_ops COMMAND test_scriptvariable_ops)
+set_tests_properties(test_scriptvariable_ops PROPERTIES TIMEOUT 15)
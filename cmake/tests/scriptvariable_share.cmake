@@ -0,0 +1,14 @@
+#
+# Unit tests
+#
+
+include(tests/game_objects)
+
+add_executable(test_scriptvariable_share
+    ${SOURCE_DIR}/script/tests/test_scriptvariable_share.cpp
+)
+
+target_link_libraries(test_scriptvariable_share PRIVATE test_game_objects)
+target_link_libraries(test_scriptvariable_share INTERFACE testing)
+add_test(NAME test_scriptvariable_share COMMAND test_scriptvariable_share)
+set_tests_properties(test_scriptvariable_share PROPERTIES TIMEOUT 15)
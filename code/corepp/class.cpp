@@ -64,6 +64,49 @@ int                   ClassDef::dump_numclasses;
 int                   ClassDef::dump_numevents;
 Container<int>        ClassDef::sortedList;
 Container<ClassDef *> ClassDef::sortedClassList;
+bool                  ClassDef::classesNumbered;
+
+//
+// Classes are registered during static initialization, before any allocator is available,
+// so the name and ID indexes are fixed arrays of intrusive chains
+//
+#define CLASS_HASH_SIZE 1024
+
+static ClassDef *classNameHash[CLASS_HASH_SIZE];
+static ClassDef *classIDHash[CLASS_HASH_SIZE];
+
+static unsigned int ClassHashName(const char *name)
+{
+    const char  *p;
+    unsigned int hash = 0;
+
+    for (p = name; *p; p++) {
+        hash = tolower((unsigned char)*p) + 31 * hash;
+    }
+
+    return hash & (CLASS_HASH_SIZE - 1);
+}
+
+// classes sharing a name or an ID are found in registration order, like in the class list
+static void ClassHashAdd(ClassDef **bucket, ClassDef *c, ClassDef *ClassDef::*hashNext)
+{
+    while (*bucket) {
+        bucket = &((*bucket)->*hashNext);
+    }
+
+    c->*hashNext = NULL;
+    *bucket      = c;
+}
+
+static void ClassHashRemove(ClassDef **bucket, ClassDef *c, ClassDef *ClassDef::*hashNext)
+{
+    for (; *bucket; bucket = &((*bucket)->*hashNext)) {
+        if (*bucket == c) {
+            *bucket = c->*hashNext;
+            break;
+        }
+    }
+}
 
 int ClassDef::compareClasses(const void *arg1, const void *arg2)
 {
@@ -90,11 +133,25 @@ void ClassDef::SortClassList(Container<ClassDef *> *sortedList)
 
 ClassDef *getClassForID(const char *name)
 {
-    ClassDef *classlist = ClassDef::classlist;
     ClassDef *c;
 
-    for (c = classlist; c; c = c->next) {
-        if (c->classID && !Q_stricmp(c->classID, name)) {
+    if (name == NULL) {
+        return NULL;
+    }
+
+    if (!*name) {
+        // classes without an ID are not indexed
+        for (c = ClassDef::classlist; c; c = c->next) {
+            if (!*c->classID) {
+                return c;
+            }
+        }
+
+        return NULL;
+    }
+
+    for (c = classIDHash[ClassHashName(name)]; c; c = c->idHashNext) {
+        if (!Q_stricmp(c->classID, name)) {
             return c;
         }
     }
@@ -104,14 +161,13 @@ ClassDef *getClassForID(const char *name)
 
 ClassDef *getClass(const char *name)
 {
+    ClassDef *c;
+
     if (name == NULL || !*name) {
         return NULL;
     }
 
-    ClassDef *list = ClassDef::classlist;
-    ClassDef *c;
-
-    for (c = list; c; c = c->next) {
+    for (c = classNameHash[ClassHashName(name)]; c; c = c->nameHashNext) {
         if (Q_stricmp(c->classname, name) == 0) {
             return c;
         }
@@ -152,14 +208,17 @@ void listInheritanceOrder(const char *classname)
 
 qboolean checkInheritance(const ClassDef *superclass, const ClassDef *subclass)
 {
-    const ClassDef *c;
+    if (!superclass || !subclass) {
+        return false;
+    }
 
-    for (c = subclass; c != NULL; c = c->super) {
-        if (c == superclass) {
-            return true;
-        }
+    if (!ClassDef::classesNumbered) {
+        ClassDef::NumberClasses();
     }
-    return false;
+
+    // subclasses are numbered right after their superclass
+    return subclass->inheritanceIndex >= superclass->inheritanceIndex
+        && subclass->inheritanceIndex <= superclass->lastSubclassIndex;
 }
 
 qboolean checkInheritance(ClassDef *superclass, const char *subclass)
@@ -348,17 +407,23 @@ const char *Class::getSuperclass(void) const
 
 ClassDef::ClassDef()
 {
-    this->classname      = NULL;
-    this->classID        = NULL;
-    this->superclass     = NULL;
-    this->responses      = NULL;
-    this->numEvents      = 0;
-    this->responseLookup = NULL;
-    this->newInstance    = NULL;
-    this->classSize      = 0;
-    this->super          = NULL;
-    this->prev           = this;
-    this->next           = this;
+    this->classname   = NULL;
+    this->classID     = NULL;
+    this->superclass  = NULL;
+    this->responses   = NULL;
+    this->numEvents   = 0;
+    this->newInstance = NULL;
+    this->classSize   = 0;
+    this->super       = NULL;
+    this->prev        = this;
+    this->next        = this;
+
+    this->nameHashNext      = NULL;
+    this->idHashNext        = NULL;
+    this->inheritanceIndex  = 0;
+    this->lastSubclassIndex = 0;
+    this->firstSubclass     = NULL;
+    this->nextSibling       = NULL;
 
 #ifdef WITH_SCRIPT_ENGINE
     this->waitTillSet = NULL;
@@ -380,15 +445,19 @@ ClassDef::ClassDef(
         classlist = this;
     }
 
-    this->classname      = classname;
-    this->classID        = classID;
-    this->superclass     = superclass;
-    this->responses      = responses;
-    this->numEvents      = 0;
-    this->responseLookup = NULL;
-    this->newInstance    = newInstance;
-    this->classSize      = classSize;
-    this->super          = getClass(superclass);
+    this->classname   = classname;
+    this->classID     = classID;
+    this->superclass  = superclass;
+    this->responses   = responses;
+    this->numEvents   = 0;
+    this->newInstance = newInstance;
+    this->classSize   = classSize;
+    this->super       = getClass(superclass);
+
+    this->inheritanceIndex  = 0;
+    this->lastSubclassIndex = 0;
+    this->firstSubclass     = NULL;
+    this->nextSibling       = NULL;
 
 #ifdef WITH_SCRIPT_ENGINE
     this->waitTillSet = NULL;
@@ -398,6 +467,13 @@ ClassDef::ClassDef(
         this->classID = "";
     }
 
+    ClassHashAdd(&classNameHash[ClassHashName(this->classname)], this, &ClassDef::nameHashNext);
+    if (*this->classID) {
+        ClassHashAdd(&classIDHash[ClassHashName(this->classID)], this, &ClassDef::idHashNext);
+    } else {
+        this->idHashNext = NULL;
+    }
+
     for (node = classlist; node; node = node->next) {
         if ((node->super == NULL) && (!Q_stricmp(node->superclass, this->classname))
             && (Q_stricmp(node->classname, "Class"))) {
@@ -409,6 +485,7 @@ ClassDef::ClassDef(
     LL_SafeAdd(classroot, this, next, prev);
 
     numclasses++;
+    classesNumbered = false;
 }
 
 ClassDef::~ClassDef()
@@ -417,6 +494,13 @@ ClassDef::~ClassDef()
 
     LL_SafeRemoveRoot(classlist, this, next, prev);
 
+    if (classname) {
+        ClassHashRemove(&classNameHash[ClassHashName(classname)], this, &ClassDef::nameHashNext);
+        if (*classID) {
+            ClassHashRemove(&classIDHash[ClassHashName(classID)], this, &ClassDef::idHashNext);
+        }
+    }
+
     // Check if any subclasses were initialized before their superclass
     for (node = classlist; node; node = node->next) {
         if (node->super == this) {
@@ -424,10 +508,8 @@ ClassDef::~ClassDef()
         }
     }
 
-    if (responseLookup) {
-        delete[] responseLookup;
-        responseLookup = NULL;
-    }
+    classesNumbered = false;
+
 #ifdef WITH_SCRIPT_ENGINE
     if (waitTillSet) {
         delete waitTillSet;
@@ -508,50 +590,76 @@ int ClassDef::GetFlags(Event *event)
 
 void ClassDef::BuildResponseList(void)
 {
-    ClassDef           *c;
     ResponseDef<Class> *r;
-    int                 ev;
     int                 i;
-    qboolean           *set;
-    int                 num;
 
-    if (responseLookup) {
-        delete[] responseLookup;
-        responseLookup = NULL;
+    // the table starts as a copy of the superclass one, only pages with overridden responses are allocated
+    if (super && super->responseLookup.IsEmpty()) {
+        super->BuildResponseList();
     }
-    //size will be total event count, because it WAS faster to look for an event via eventnum
-    //nowadays there's not much overhead in performance, TODO: change size to appropriate.
-    num            = Event::NumEventCommands();
-    responseLookup = (ResponseDef<Class> **)new char[sizeof(ResponseDef<Class> *) * num];
-    memset(responseLookup, 0, sizeof(ResponseDef<Class> *) * num);
 
-    set = new qboolean[num];
-    memset(set, 0, sizeof(qboolean) * num);
+    numEvents = Event::NumEventCommands();
+    responseLookup.Init(numEvents, super ? &super->responseLookup : NULL);
 
-    this->numEvents = num;
+    r = responses;
+    if (!r) {
+        return;
+    }
 
-    for (c = this; c != NULL; c = c->super) {
-        r = c->responses;
+    for (i = 0; r[i].event != NULL; i++) {
+        r[i].def = r[i].event->getInfo();
+    }
 
-        if (r) {
-            for (i = 0; r[i].event != NULL; i++) {
-                ev       = (int)r[i].event->eventnum;
-                r[i].def = r[i].event->getInfo();
+    // the first response of an event takes precedence
+    for (i--; i >= 0; i--) {
+        ResponseDef<Class> *response = r[i].response ? &r[i] : NULL;
 
-                if (!set[ev]) {
-                    set[ev] = true;
+        if (responseLookup[r[i].event->eventnum] != response) {
+            responseLookup.Set(r[i].event->eventnum, response);
+        }
+    }
+}
 
-                    if (r[i].response) {
-                        responseLookup[ev] = &r[i];
-                    } else {
-                        responseLookup[ev] = NULL;
-                    }
-                }
-            }
+static int NumberSubclasses(ClassDef *c, int index)
+{
+    ClassDef *sub;
+
+    c->inheritanceIndex = ++index;
+    for (sub = c->firstSubclass; sub; sub = sub->nextSibling) {
+        index = NumberSubclasses(sub, index);
+    }
+    c->lastSubclassIndex = index;
+
+    return index;
+}
+
+void ClassDef::NumberClasses(void)
+{
+    ClassDef *c;
+    int       index;
+
+    for (c = classlist; c; c = c->next) {
+        c->firstSubclass = NULL;
+    }
+
+    for (c = classlist; c; c = c->next) {
+        if (c->super) {
+            c->nextSibling          = c->super->firstSubclass;
+            c->super->firstSubclass = c;
+        } else {
+            c->nextSibling = NULL;
         }
     }
 
-    delete[] set;
+    // classes whose superclass is unknown are numbered as separate trees
+    index = 0;
+    for (c = classlist; c; c = c->next) {
+        if (!c->super) {
+            index = NumberSubclasses(c, index);
+        }
+    }
+
+    classesNumbered = true;
 }
 
 void ClassDef::BuildEventResponses(void)
@@ -563,10 +671,21 @@ void ClassDef::BuildEventResponses(void)
     amount     = 0;
     numclasses = 0;
 
+    NumberClasses();
+
+    // tables share pages with their superclass, they are all rebuilt
     for (c = classlist; c; c = c->next) {
-        c->BuildResponseList();
+        c->responseLookup.Clear();
+    }
 
-        amount += c->numEvents * sizeof(Response *);
+    for (c = classlist; c; c = c->next) {
+        if (c->responseLookup.IsEmpty()) {
+            c->BuildResponseList();
+        }
+    }
+
+    for (c = classlist; c; c = c->next) {
+        amount += c->responseLookup.MemoryUsage();
         numclasses++;
     }
 
@@ -25,6 +25,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #pragma once
 
 #include "con_set.h"
+#include "con_pagedarray.h"
 #include "../corepp/container.h"
 #include "../qcommon/q_shared.h"
 #include "../corepp/str.h"
@@ -180,11 +181,23 @@ public:
     void *(*newInstance)(void);
     int                  classSize;
     ResponseDef<Class>  *responses;
-    ResponseDef<Class> **responseLookup;
     ClassDef            *super;
     ClassDef            *next;
     ClassDef            *prev;
 
+    // response of each event, pages without overridden responses are shared with the superclass
+    con_pagedarray<ResponseDef<Class> *> responseLookup;
+
+    // case-insensitive lookup by name and by ID
+    ClassDef *nameHashNext;
+    ClassDef *idHashNext;
+
+    // pre-order number of the class in the inheritance tree, and the highest number among its subclasses
+    int       inheritanceIndex;
+    int       lastSubclassIndex;
+    ClassDef *firstSubclass;
+    ClassDef *nextSibling;
+
 #ifdef WITH_SCRIPT_ENGINE
     con_set<const_str, const_str> *waitTillSet;
 #endif
@@ -194,6 +207,7 @@ public:
     static ClassDef *classlist;
     static ClassDef *classroot;
     static int       numclasses;
+    static bool      classesNumbered;
 
     static int                   dump_numclasses;
     static int                   dump_numevents;
@@ -234,6 +248,7 @@ public:
 
 public:
     static void BuildEventResponses();
+    static void NumberClasses();
 
     void BuildResponseList();
 };
@@ -0,0 +1,214 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// con_heap.h: Intrusive binary min-heap.
+//
+// The heap stores pointers to nodes. A node type must provide:
+//  - an 'int heapIndex' member, used by the heap to track the node position
+//    (1-based, 0 when the node is not in the heap)
+//  - 'bool operator<(const Type& other) const', which must define a strict order
+//    (use a sequence number to break ties when keys can be equal)
+
+#pragma once
+
+#include "container.h"
+
+template<class Type>
+class con_heap
+{
+private:
+    Container<Type *> m_Nodes;
+
+private:
+    void Place(int index, Type *node);
+    void SiftUp(int index);
+    void SiftDown(int index);
+
+public:
+    void Add(Type *node);
+    void Remove(Type *node);
+    void Update(Type *node);
+    void Clear(void);
+
+    Type *Top(void) const;
+    Type *Pop(void);
+
+    int   NumObjects(void) const;
+    Type *ObjectAt(int index) const;
+};
+
+template<class Type>
+inline void con_heap<Type>::Place(int index, Type *node)
+{
+    m_Nodes.ObjectAt(index) = node;
+    node->heapIndex         = index;
+}
+
+template<class Type>
+void con_heap<Type>::SiftUp(int index)
+{
+    Type *node = m_Nodes.ObjectAt(index);
+
+    while (index > 1) {
+        const int parentIndex = index >> 1;
+        Type     *parent      = m_Nodes.ObjectAt(parentIndex);
+
+        if (!(*node < *parent)) {
+            break;
+        }
+
+        Place(index, parent);
+        index = parentIndex;
+    }
+
+    Place(index, node);
+}
+
+template<class Type>
+void con_heap<Type>::SiftDown(int index)
+{
+    const int num  = m_Nodes.NumObjects();
+    Type     *node = m_Nodes.ObjectAt(index);
+
+    for (;;) {
+        int childIndex = index << 1;
+
+        if (childIndex > num) {
+            break;
+        }
+
+        if (childIndex < num && *m_Nodes.ObjectAt(childIndex + 1) < *m_Nodes.ObjectAt(childIndex)) {
+            childIndex++;
+        }
+
+        if (!(*m_Nodes.ObjectAt(childIndex) < *node)) {
+            break;
+        }
+
+        Place(index, m_Nodes.ObjectAt(childIndex));
+        index = childIndex;
+    }
+
+    Place(index, node);
+}
+
+template<class Type>
+void con_heap<Type>::Add(Type *node)
+{
+    assert(!node->heapIndex);
+
+    node->heapIndex = m_Nodes.AddObject(node);
+    SiftUp(node->heapIndex);
+}
+
+template<class Type>
+void con_heap<Type>::Remove(Type *node)
+{
+    const int index = node->heapIndex;
+    const int num   = m_Nodes.NumObjects();
+    Type     *last;
+
+    if (!index) {
+        return;
+    }
+
+    assert(m_Nodes.ObjectAt(index) == node);
+
+    node->heapIndex = 0;
+    last            = m_Nodes.ObjectAt(num);
+    m_Nodes.RemoveObjectAt(num);
+
+    if (index == num) {
+        return;
+    }
+
+    Place(index, last);
+
+    if (index > 1 && *last < *m_Nodes.ObjectAt(index >> 1)) {
+        SiftUp(index);
+    } else {
+        SiftDown(index);
+    }
+}
+
+template<class Type>
+void con_heap<Type>::Update(Type *node)
+{
+    const int index = node->heapIndex;
+
+    if (!index) {
+        return;
+    }
+
+    if (index > 1 && *node < *m_Nodes.ObjectAt(index >> 1)) {
+        SiftUp(index);
+    } else {
+        SiftDown(index);
+    }
+}
+
+template<class Type>
+void con_heap<Type>::Clear(void)
+{
+    int i;
+
+    for (i = m_Nodes.NumObjects(); i > 0; i--) {
+        m_Nodes.ObjectAt(i)->heapIndex = 0;
+    }
+
+    m_Nodes.FreeObjectList();
+}
+
+template<class Type>
+inline Type *con_heap<Type>::Top(void) const
+{
+    if (!m_Nodes.NumObjects()) {
+        return NULL;
+    }
+
+    return m_Nodes.ObjectAt(1);
+}
+
+template<class Type>
+Type *con_heap<Type>::Pop(void)
+{
+    Type *node = Top();
+
+    if (node) {
+        Remove(node);
+    }
+
+    return node;
+}
+
+template<class Type>
+inline int con_heap<Type>::NumObjects(void) const
+{
+    return m_Nodes.NumObjects();
+}
+
+// Nodes are returned in heap order, not in sorted order
+template<class Type>
+inline Type *con_heap<Type>::ObjectAt(int index) const
+{
+    return m_Nodes.ObjectAt(index);
+}
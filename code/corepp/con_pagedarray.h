@@ -0,0 +1,187 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// con_pagedarray.h: Fixed-length array split in pages that can be shared with a base array.
+//
+// An array starts as a view of its base array (or of an empty page filled with Type()),
+// and only the pages that are written to are copied. Arrays deriving from each other
+// with few differences, like the response tables of a class and of its superclass,
+// then share most of their memory.
+//
+// The base array must not be modified or destroyed while arrays share its pages.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+#define PAGEDARRAY_SHIFT     5
+#define PAGEDARRAY_PAGE_SIZE (1 << PAGEDARRAY_SHIFT)
+#define PAGEDARRAY_MASK      (PAGEDARRAY_PAGE_SIZE - 1)
+
+template<class Type>
+class con_pagedarray
+{
+private:
+    Type **pages;
+    bool  *ownPage;
+    int    numPages;
+    int    numOwnPages;
+
+    static Type emptyPage[PAGEDARRAY_PAGE_SIZE];
+
+public:
+    con_pagedarray();
+    ~con_pagedarray();
+
+    void Init(int length, const con_pagedarray<Type> *base);
+    void Clear(void);
+    void Set(int index, const Type& value);
+
+    bool IsEmpty(void) const;
+    int  NumPages(void) const;
+    int  NumOwnPages(void) const;
+    int  MemoryUsage(void) const;
+
+    const Type& operator[](int index) const;
+};
+
+template<class Type>
+Type con_pagedarray<Type>::emptyPage[PAGEDARRAY_PAGE_SIZE];
+
+template<class Type>
+con_pagedarray<Type>::con_pagedarray()
+{
+    pages       = NULL;
+    ownPage     = NULL;
+    numPages    = 0;
+    numOwnPages = 0;
+}
+
+template<class Type>
+con_pagedarray<Type>::~con_pagedarray()
+{
+    Clear();
+}
+
+template<class Type>
+void con_pagedarray<Type>::Init(int length, const con_pagedarray<Type> *base)
+{
+    int i;
+
+    Clear();
+
+    numPages = (length + PAGEDARRAY_MASK) >> PAGEDARRAY_SHIFT;
+    if (!numPages) {
+        return;
+    }
+
+    pages   = new Type *[numPages];
+    ownPage = new bool[numPages];
+
+    for (i = 0; i < numPages; i++) {
+        if (base && i < base->numPages) {
+            pages[i] = base->pages[i];
+        } else {
+            pages[i] = emptyPage;
+        }
+
+        ownPage[i] = false;
+    }
+}
+
+template<class Type>
+void con_pagedarray<Type>::Clear(void)
+{
+    int i;
+
+    for (i = 0; i < numPages; i++) {
+        if (ownPage[i]) {
+            delete[] pages[i];
+        }
+    }
+
+    if (pages) {
+        delete[] pages;
+        delete[] ownPage;
+    }
+
+    pages       = NULL;
+    ownPage     = NULL;
+    numPages    = 0;
+    numOwnPages = 0;
+}
+
+template<class Type>
+void con_pagedarray<Type>::Set(int index, const Type& value)
+{
+    const int pageIndex = index >> PAGEDARRAY_SHIFT;
+    Type     *page;
+    int       i;
+
+    assert(pageIndex >= 0 && pageIndex < numPages);
+
+    if (!ownPage[pageIndex]) {
+        // copy the shared page before writing to it
+        page = new Type[PAGEDARRAY_PAGE_SIZE];
+        for (i = 0; i < PAGEDARRAY_PAGE_SIZE; i++) {
+            page[i] = pages[pageIndex][i];
+        }
+
+        pages[pageIndex]   = page;
+        ownPage[pageIndex] = true;
+        numOwnPages++;
+    }
+
+    pages[pageIndex][index & PAGEDARRAY_MASK] = value;
+}
+
+template<class Type>
+inline bool con_pagedarray<Type>::IsEmpty(void) const
+{
+    return pages == NULL;
+}
+
+template<class Type>
+inline int con_pagedarray<Type>::NumPages(void) const
+{
+    return numPages;
+}
+
+template<class Type>
+inline int con_pagedarray<Type>::NumOwnPages(void) const
+{
+    return numOwnPages;
+}
+
+// Memory used by this array, shared pages excluded
+template<class Type>
+inline int con_pagedarray<Type>::MemoryUsage(void) const
+{
+    return numPages * (sizeof(Type *) + sizeof(bool)) + numOwnPages * PAGEDARRAY_PAGE_SIZE * sizeof(Type);
+}
+
+template<class Type>
+inline const Type& con_pagedarray<Type>::operator[](int index) const
+{
+    return pages[index >> PAGEDARRAY_SHIFT][index & PAGEDARRAY_MASK];
+}
@@ -26,6 +26,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "mem_blockalloc.h"
 
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
 #if defined(GAME_DLL)
 #    include "../fgame/g_local.h"
 
@@ -89,21 +93,15 @@ class con_set_Entry
     friend con_set_enum<k, v>;
 
 private:
-    con_set_Entry *next;
-    k              key;
+    k key;
 
 public:
     v value;
 
 public:
-    void *operator new(size_t size) { return con_set<k, v>::NewEntry(size); }
-
-    void operator delete(void *ptr) { con_set<k, v>::DeleteEntry(ptr); }
-
     con_set_Entry()
         : key(k())
         , value(v())
-        , next(NULL)
     {}
 
 #ifdef ARCHIVE_SUPPORTED
@@ -114,6 +112,30 @@ public:
     void SetKey(const k& newKey) { key = newKey; }
 };
 
+// Smallest table allocated by con_set, must be a power of two
+#define CON_SET_MIN_LENGTH 4
+
+// Index of the highest bit set, value must not be 0
+inline unsigned int con_set_log2(unsigned int value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+
+    _BitScanReverse(&index, value);
+    return index;
+#else
+    return 31 - __builtin_clz(value);
+#endif
+}
+
+//
+// Open addressing hash table (robin hood hashing, backward shift deletion).
+//
+// Entries are stored in chunks owned by the set, each chunk is twice as large
+// as the previous one. Entries never move so pointers to keys and values stay valid
+// until the entry is removed. The table only holds the hash and the index of each entry,
+// so that most probes don't touch the entries.
+//
 template<typename k, typename v>
 class con_set
 {
@@ -122,25 +144,44 @@ class con_set
 public:
     using Entry = con_set_Entry<k, v>;
 
-public:
-    static MEM_BlockAlloc<Entry> Entry_allocator;
+    class Slot
+    {
+    public:
+        unsigned int hash;
+        unsigned int index; // 1-based entry index, 0 if the slot is empty
+    };
 
 protected:
-    Entry            **table; // hashtable
-    unsigned int       tableLength;
+    Slot              *table; // hashtable, NULL until the first entry is added
+    unsigned int       tableLength; // 0 or a power of two
     unsigned int       threshold;
     unsigned int       count; // num of entries
-    short unsigned int tableLengthIndex;
-    Entry             *defaultEntry;
+    short unsigned int tableLengthIndex; // log2 of tableLength
+
+    Entry      **chunks; // chunk n holds 2^n entries
+    unsigned int numChunks;
+    unsigned int maxChunks;
+    unsigned int numEntries; // entries used so far, including removed ones
+    unsigned int freeEntry; // last removed entry, 0 if none
 
 protected:
+    static unsigned int HashKey(const k& key);
+
+    unsigned int HomeIndex(unsigned int hash) const;
+    unsigned int ProbeDistance(unsigned int index, unsigned int hash) const;
+    void         rehash(unsigned int newLength);
+    void         insertEntry(unsigned int hash, unsigned int index);
+    Slot        *findKeySlot(const k& key) const;
+
+    Entry       *EntryAt(unsigned int index) const;
+    unsigned int NewEntryIndex(void);
+    void         DeleteEntryIndex(unsigned int index);
+
     Entry *findKeyEntry(const k& key) const;
     Entry *addKeyEntry(const k& key);
     Entry *addNewKeyEntry(const k& key);
 
 public:
-    static void *NewEntry(size_t size);
-    static void  DeleteEntry(void *entry);
     static void *NewTable(size_t count);
     static void  DeleteTable(void *table);
 
@@ -153,7 +194,7 @@ public:
 #endif
 
     void clear();
-    void resize(int count = 0);
+    void resize(int numNew = 0);
 
     v *findKeyValue(const k& key) const;
     k *firstKeyValue();
@@ -168,25 +209,10 @@ public:
     unsigned int size() const;
 };
 
-template<typename k, typename v>
-MEM_BlockAlloc<typename con_set<k, v>::Entry> con_set<k, v>::Entry_allocator;
-
-template<typename k, typename v>
-void *con_set<k, v>::NewEntry(size_t size)
-{
-    return Entry_allocator.Alloc();
-}
-
-template<typename k, typename v>
-void con_set<k, v>::DeleteEntry(void *entry)
-{
-    Entry_allocator.Free(entry);
-}
-
 template<typename k, typename v>
 void *con_set<k, v>::NewTable(size_t count)
 {
-    return SET_Alloc(sizeof(Entry *) * (int)count);
+    return SET_Alloc(sizeof(Slot) * (int)count);
 }
 
 template<typename k, typename v>
@@ -201,14 +227,17 @@ int HashCode(const k& key);
 template<typename key, typename value>
 con_set<key, value>::con_set()
 {
-    tableLength = 1;
-    table       = &defaultEntry;
-
-    threshold        = 1;
+    table            = NULL;
+    tableLength      = 0;
+    threshold        = 0;
     count            = 0;
     tableLengthIndex = 0;
 
-    defaultEntry = NULL;
+    chunks     = NULL;
+    numChunks  = 0;
+    maxChunks  = 0;
+    numEntries = 0;
+    freeEntry  = 0;
 }
 
 template<typename key, typename value>
@@ -217,90 +246,236 @@ con_set<key, value>::~con_set()
     clear();
 }
 
+template<typename k, typename v>
+unsigned int con_set<k, v>::HashKey(const k& key)
+{
+    // HashCode is often the key itself, spread it over the high bits
+    return (unsigned int)HashCode<k>(key) * 0x9E3779B9u;
+}
+
+template<typename k, typename v>
+inline unsigned int con_set<k, v>::HomeIndex(unsigned int hash) const
+{
+    return hash >> (32 - tableLengthIndex);
+}
+
+template<typename k, typename v>
+inline unsigned int con_set<k, v>::ProbeDistance(unsigned int index, unsigned int hash) const
+{
+    return (index - HomeIndex(hash)) & (tableLength - 1);
+}
+
+template<typename k, typename v>
+inline typename con_set<k, v>::Entry *con_set<k, v>::EntryAt(unsigned int index) const
+{
+    const unsigned int chunk = con_set_log2(index);
+
+    return &chunks[chunk][index - (1 << chunk)];
+}
+
+template<typename k, typename v>
+unsigned int con_set<k, v>::NewEntryIndex(void)
+{
+    unsigned int index;
+
+    if (freeEntry) {
+        // reuse the storage of a removed entry
+        index     = freeEntry;
+        freeEntry = *(unsigned int *)EntryAt(index);
+    } else {
+        index = ++numEntries;
+
+        if (index == (1u << numChunks)) {
+            if (numChunks == maxChunks) {
+                Entry **oldChunks = chunks;
+
+                maxChunks = maxChunks ? maxChunks * 2 : 4;
+                chunks    = (Entry **)SET_Alloc(sizeof(Entry *) * maxChunks);
+
+                if (oldChunks) {
+                    memcpy(chunks, oldChunks, sizeof(Entry *) * numChunks);
+                    SET_Free(oldChunks);
+                }
+            }
+
+            chunks[numChunks] = (Entry *)SET_Alloc(sizeof(Entry) << numChunks);
+            numChunks++;
+        }
+    }
+
+    ::new (EntryAt(index)) Entry;
+
+    return index;
+}
+
+template<typename k, typename v>
+void con_set<k, v>::DeleteEntryIndex(unsigned int index)
+{
+    static_assert(sizeof(Entry) >= sizeof(unsigned int), "removed entries must be able to hold an index");
+
+    Entry *entry = EntryAt(index);
+
+    entry->~Entry();
+
+    *(unsigned int *)entry = freeEntry;
+    freeEntry              = index;
+}
+
 template<typename key, typename value>
 void con_set<key, value>::clear()
 {
-    Entry       *entry = NULL;
-    Entry       *next  = NULL;
     unsigned int i;
 
     for (i = 0; i < tableLength; i++) {
-        for (entry = table[i]; entry != NULL; entry = next) {
-            next = entry->next;
-            delete entry;
+        if (table[i].index) {
+            EntryAt(table[i].index)->~Entry();
         }
     }
 
-    if (tableLength > 1) {
-        DeleteTable(table);
+    for (i = 0; i < numChunks; i++) {
+        SET_Free(chunks[i]);
+    }
+
+    if (chunks) {
+        SET_Free(chunks);
     }
 
-    tableLength = 1;
-    table       = &defaultEntry;
+    if (table) {
+        DeleteTable(table);
+    }
 
-    threshold        = 1;
+    table            = NULL;
+    tableLength      = 0;
+    threshold        = 0;
     count            = 0;
     tableLengthIndex = 0;
 
-    defaultEntry = NULL;
+    chunks     = NULL;
+    numChunks  = 0;
+    maxChunks  = 0;
+    numEntries = 0;
+    freeEntry  = 0;
 }
 
 template<typename key, typename value>
-void con_set<key, value>::resize(int count)
+void con_set<key, value>::rehash(unsigned int newLength)
 {
-    Entry      **oldTable = table;
-    Entry       *e, *old;
+    Slot        *oldTable       = table;
     unsigned int oldTableLength = tableLength;
     unsigned int i;
-    unsigned int index;
 
-    if (count > 0) {
-        tableLength += count;
-        threshold = tableLength;
-    } else {
-        //threshold = ( unsigned int )( ( float )tableLength * 0.75f );
-        threshold = (unsigned int)((float)tableLength * 0.75);
-        if (threshold < 1) {
-            threshold = 1;
+    // allocate a new table
+    table       = new (NewTable(newLength)) Slot[newLength]();
+    tableLength = newLength;
+    threshold   = newLength - newLength / 4;
+
+    for (tableLengthIndex = 0; (1u << tableLengthIndex) < newLength; tableLengthIndex++) {}
+
+    // rehash all entries from the old table
+    for (i = 0; i < oldTableLength; i++) {
+        if (oldTable[i].index) {
+            insertEntry(oldTable[i].hash, oldTable[i].index);
         }
+    }
 
-        tableLength += threshold;
+    if (oldTable) {
+        // delete the previous table
+        DeleteTable(oldTable);
     }
+}
 
-    // allocate a new table
-    table = new (NewTable(tableLength)) Entry *[tableLength]();
+template<typename key, typename value>
+void con_set<key, value>::resize(int numNew)
+{
+    unsigned int newLength;
 
-    // rehash the table
-    for (i = oldTableLength; i > 0; i--) {
-        // rehash all entries from the old table
-        for (e = oldTable[i - 1]; e != NULL; e = old) {
-            old = e->next;
+    if (numNew > 0) {
+        // make room for the specified number of new entries
+        newLength = tableLength ? tableLength : CON_SET_MIN_LENGTH;
+        while (newLength - newLength / 4 < count + numNew) {
+            newLength *= 2;
+        }
+    } else {
+        newLength = tableLength ? tableLength * 2 : CON_SET_MIN_LENGTH;
+    }
 
-            // insert the old entry to the table hashindex
-            index = HashCode<key>(e->GetKey()) % tableLength;
+    if (newLength != tableLength) {
+        rehash(newLength);
+    }
+}
+
+template<typename k, typename v>
+void con_set<k, v>::insertEntry(unsigned int hash, unsigned int index)
+{
+    Slot         slot;
+    Slot         temp;
+    unsigned int i;
+    unsigned int distance;
+    unsigned int slotDistance;
 
-            e->next      = table[index];
-            table[index] = e;
+    slot.hash  = hash;
+    slot.index = index;
+
+    i        = HomeIndex(hash);
+    distance = 0;
+
+    for (;;) {
+        if (!table[i].index) {
+            table[i] = slot;
+            return;
         }
-    }
 
-    if (oldTableLength > 1) {
-        // delete the previous table
-        DeleteTable(oldTable);
+        // the entry that is the closest to its home index gives its place
+        slotDistance = ProbeDistance(i, table[i].hash);
+        if (slotDistance < distance) {
+            temp     = table[i];
+            table[i] = slot;
+            slot     = temp;
+            distance = slotDistance;
+        }
+
+        i = (i + 1) & (tableLength - 1);
+        distance++;
     }
 }
 
 template<typename k, typename v>
-typename con_set<k, v>::Entry *con_set<k, v>::findKeyEntry(const k& key) const
+typename con_set<k, v>::Slot *con_set<k, v>::findKeySlot(const k& key) const
 {
-    Entry *entry;
+    unsigned int hash;
+    unsigned int index;
+    unsigned int distance;
 
-    entry = table[HashCode<k>(key) % tableLength];
+    if (!count) {
+        return NULL;
+    }
+
+    hash  = HashKey(key);
+    index = HomeIndex(hash);
+
+    for (distance = 0;; distance++) {
+        Slot *slot = &table[index];
+
+        // past this point the key would have taken the place of the slot
+        if (!slot->index || ProbeDistance(index, slot->hash) < distance) {
+            return NULL;
+        }
 
-    for (; entry != NULL; entry = entry->next) {
-        if (entry->GetKey() == key) {
-            return entry;
+        if (slot->hash == hash && EntryAt(slot->index)->GetKey() == key) {
+            return slot;
         }
+
+        index = (index + 1) & (tableLength - 1);
+    }
+}
+
+template<typename k, typename v>
+typename con_set<k, v>::Entry *con_set<k, v>::findKeyEntry(const k& key) const
+{
+    Slot *slot = findKeySlot(key);
+
+    if (slot != NULL) {
+        return EntryAt(slot->index);
     }
 
     return NULL;
@@ -323,8 +498,8 @@ typename con_set<k, v>::Entry *con_set<k, v>::addKeyEntry(const k& key)
 template<typename k, typename v>
 typename con_set<k, v>::Entry *con_set<k, v>::addNewKeyEntry(const k& key)
 {
-    Entry *entry;
-    int    hash;
+    Entry       *entry;
+    unsigned int index;
 
     if (count >= threshold) {
         resize();
@@ -332,17 +507,11 @@ typename con_set<k, v>::Entry *con_set<k, v>::addNewKeyEntry(const k& key)
 
     count++;
 
-    entry = new Entry;
+    index = NewEntryIndex();
+    entry = EntryAt(index);
     entry->SetKey(key);
-    hash = HashCode<k>(entry->GetKey()) % tableLength;
 
-    if (defaultEntry == NULL) {
-        defaultEntry = entry;
-        entry->next  = NULL;
-    } else {
-        entry->next = table[hash];
-    }
-    table[hash] = entry;
+    insertEntry(HashKey(entry->GetKey()), index);
 
     return entry;
 }
@@ -356,47 +525,38 @@ bool con_set<key, value>::isEmpty(void)
 template<typename k, typename v>
 bool con_set<k, v>::remove(const k& key)
 {
-    int    hash;
-    int    i;
-    Entry *prev = NULL;
-    Entry *entry, *e;
+    Slot        *slot;
+    unsigned int entryIndex;
+    unsigned int index;
+    unsigned int next;
 
-    hash = HashCode<k>(key) % tableLength;
+    slot = findKeySlot(key);
+    if (!slot) {
+        return false;
+    }
 
-    for (entry = table[hash]; entry != NULL; entry = entry->next) {
-        // just to make sure we're using the correct overloaded operator for the key
-        if (!(entry->GetKey() == key)) {
-            prev = entry;
-            continue;
-        }
+    entryIndex = slot->index;
+    index      = (unsigned int)(slot - table);
 
-        if (defaultEntry == entry) {
-            defaultEntry = prev ? prev : table[hash];
-            // find a default entry
-            for (i = 0; i < tableLength && !defaultEntry; i++) {
-                for (e = table[i]; e; e = e->next) {
-                    if (e == entry) {
-                        continue;
-                    }
-                    defaultEntry = e;
-                    break;
-                }
-            }
-        }
+    // shift the following entries back until one is at its home index
+    for (;;) {
+        next = (index + 1) & (tableLength - 1);
 
-        if (prev) {
-            prev->next = entry->next;
-        } else {
-            table[hash] = entry->next;
+        if (!table[next].index || !ProbeDistance(next, table[next].hash)) {
+            break;
         }
 
-        count--;
-        delete entry;
-
-        return true;
+        table[index] = table[next];
+        index        = next;
     }
 
-    return false;
+    table[index].hash  = 0;
+    table[index].index = 0;
+
+    count--;
+    DeleteEntryIndex(entryIndex);
+
+    return true;
 }
 
 template<typename k, typename v>
@@ -414,11 +574,15 @@ v *con_set<k, v>::findKeyValue(const k& key) const
 template<typename key, typename value>
 key *con_set<key, value>::firstKeyValue(void)
 {
-    if (defaultEntry) {
-        return &defaultEntry->GetKey();
-    } else {
-        return NULL;
+    unsigned int i;
+
+    for (i = 0; i < tableLength; i++) {
+        if (table[i].index) {
+            return &EntryAt(table[i].index)->GetKey();
+        }
     }
+
+    return NULL;
 }
 
 template<typename k, typename v>
@@ -440,15 +604,7 @@ v& con_set<k, v>::addNewKeyValue(const k& key)
 template<typename k, typename v>
 bool con_set<k, v>::keyExists(const k& key)
 {
-    Entry *entry;
-
-    for (entry = table; entry != NULL; entry = entry->next) {
-        if (entry->GetKey() == key) {
-            return true;
-        }
-    }
-
-    return false;
+    return findKeySlot(key) != NULL;
 }
 
 template<typename key, typename value>
@@ -468,8 +624,8 @@ public:
 protected:
     con_set<key, value> *m_Set;
     unsigned int         m_Index;
+    unsigned int         m_Remaining;
     Entry               *m_CurrentEntry;
-    Entry               *m_NextEntry;
 
 public:
     con_set_enum();
@@ -486,8 +642,8 @@ con_set_enum<key, value>::con_set_enum()
 {
     m_Set          = NULL;
     m_Index        = 0;
+    m_Remaining    = 0;
     m_CurrentEntry = NULL;
-    m_NextEntry    = NULL;
 }
 
 template<typename key, typename value>
@@ -499,10 +655,26 @@ con_set_enum<key, value>::con_set_enum(con_set<key, value>& set)
 template<typename key, typename value>
 bool con_set_enum<key, value>::operator=(con_set<key, value>& set)
 {
+    unsigned int i;
+
     m_Set          = &set;
-    m_Index        = m_Set->tableLength;
+    m_Index        = 0;
+    m_Remaining    = 0;
     m_CurrentEntry = NULL;
-    m_NextEntry    = NULL;
+
+    if (!set.table) {
+        return true;
+    }
+
+    //
+    // Slots are visited backward starting below an empty slot (there is always one).
+    // When the current entry is removed, the entries that are shifted back
+    // have already been visited
+    //
+    for (i = 0; set.table[i].index; i++) {}
+
+    m_Index     = i;
+    m_Remaining = set.tableLength;
 
     return true;
 }
@@ -516,30 +688,18 @@ typename con_set_enum<key, value>::Entry *con_set_enum<key, value>::CurrentEleme
 template<typename key, typename value>
 typename con_set_enum<key, value>::Entry *con_set_enum<key, value>::NextElement(void)
 {
-    if (!m_NextEntry) {
-        while (1) {
-            if (!m_Index) {
-                break;
-            }
-
-            m_Index--;
-            m_NextEntry = m_Set->table[m_Index];
-
-            if (m_NextEntry) {
-                break;
-            }
-        }
+    while (m_Remaining && m_Set->table) {
+        m_Remaining--;
+        m_Index = (m_Index - 1) & (m_Set->tableLength - 1);
 
-        if (!m_NextEntry) {
-            m_CurrentEntry = NULL;
-            return NULL;
+        if (m_Set->table[m_Index].index) {
+            m_CurrentEntry = m_Set->EntryAt(m_Set->table[m_Index].index);
+            return m_CurrentEntry;
         }
     }
 
-    m_CurrentEntry = m_NextEntry;
-    m_NextEntry    = m_NextEntry->next;
-
-    return m_CurrentEntry;
+    m_CurrentEntry = NULL;
+    return NULL;
 }
 
 template<typename key, typename value>
@@ -628,8 +788,8 @@ con_map_enum<key, value>::con_map_enum()
 {
     m_Set_Enum.m_Set          = NULL;
     m_Set_Enum.m_Index        = 0;
+    m_Set_Enum.m_Remaining    = 0;
     m_Set_Enum.m_CurrentEntry = NULL;
-    m_Set_Enum.m_NextEntry    = NULL;
 }
 
 template<typename key, typename value>
@@ -0,0 +1,392 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// con_strpool.h: Pool of unique strings, each one identified by an index starting at 1.
+//
+// Strings stay in the pool until it is cleared, so indexes and references to the strings
+// remain valid. Each entry keeps the hash of its string: growing the table doesn't hash
+// the strings again, and lookups only compare the strings whose hash match.
+//
+// Lookups of a C string first check a small cache of the pointers looked up recently.
+// The c_str() of a string of the pool is found without comparing the characters,
+// other pointers (string literals, buffers) are found with a single comparison.
+
+#pragma once
+
+#include "str.h"
+#include "con_set.h"
+
+// Recently looked up pointers are kept in 2^STRPOOL_RECENT_BITS slots
+#define STRPOOL_RECENT_BITS 10
+#define STRPOOL_NUM_RECENT  (1 << STRPOOL_RECENT_BITS)
+
+class con_strpool
+{
+public:
+    class Entry
+    {
+    public:
+        str          string;
+        unsigned int hash;
+    };
+
+    class Slot
+    {
+    public:
+        unsigned int hash;
+        unsigned int index; // 0 if the slot is empty
+    };
+
+    class Recent
+    {
+    public:
+        const char  *pointer;
+        unsigned int index;
+    };
+
+protected:
+    Slot              *table; // NULL until the first string is added
+    unsigned int       tableLength;
+    unsigned int       threshold;
+    short unsigned int tableLengthIndex;
+
+    Entry      **chunks; // chunk n holds the strings 2^n to 2^(n+1)-1
+    unsigned int numChunks;
+    unsigned int maxChunks;
+    unsigned int count;
+    size_t       numChars; // characters of all strings, including the terminating zeros
+
+    Recent recent[STRPOOL_NUM_RECENT];
+
+    // statistics
+    size_t numLookups;
+    size_t numRecentHits;
+
+protected:
+    static unsigned int Hash(const char *s);
+
+    Entry       *EntryAt(unsigned int index) const;
+    Recent      *RecentSlot(const char *s);
+    unsigned int findHashed(const char *s, unsigned int hash) const;
+    unsigned int addNew(const str& s, unsigned int hash);
+    void         rehash(unsigned int newLength);
+
+public:
+    con_strpool();
+    ~con_strpool();
+
+    void clear();
+
+    unsigned int findKeyIndex(const char *s);
+    unsigned int findKeyIndex(const str& s);
+    unsigned int addKeyIndex(const char *s);
+    unsigned int addKeyIndex(const str& s);
+
+    str&         operator[](unsigned int index);
+    unsigned int size() const;
+
+    size_t MemoryUsage() const;
+    size_t NumLookups() const;
+    size_t NumRecentHits() const;
+    void   ResetStats();
+};
+
+inline con_strpool::con_strpool()
+{
+    table            = NULL;
+    tableLength      = 0;
+    threshold        = 0;
+    tableLengthIndex = 0;
+
+    chunks    = NULL;
+    numChunks = 0;
+    maxChunks = 0;
+    count     = 0;
+    numChars  = 0;
+
+    memset(recent, 0, sizeof(recent));
+
+    numLookups    = 0;
+    numRecentHits = 0;
+}
+
+inline con_strpool::~con_strpool()
+{
+    clear();
+}
+
+inline unsigned int con_strpool::Hash(const char *s)
+{
+    // same as HashCode<const char *>, spread over the high bits like con_set
+    return (unsigned int)HashCode<const char *>(s) * 0x9E3779B9u;
+}
+
+inline con_strpool::Entry *con_strpool::EntryAt(unsigned int index) const
+{
+    const unsigned int chunk = con_set_log2(index);
+
+    return &chunks[chunk][index - (1 << chunk)];
+}
+
+inline con_strpool::Recent *con_strpool::RecentSlot(const char *s)
+{
+    // strings are allocated on at least 8 bytes boundaries
+    const unsigned int p = (unsigned int)((uintptr_t)s >> 3);
+
+    return &recent[(p * 0x9E3779B9u) >> (32 - STRPOOL_RECENT_BITS)];
+}
+
+inline void con_strpool::clear()
+{
+    unsigned int i;
+
+    for (i = 1; i <= count; i++) {
+        EntryAt(i)->~Entry();
+    }
+
+    for (i = 0; i < numChunks; i++) {
+        SET_Free(chunks[i]);
+    }
+
+    if (chunks) {
+        SET_Free(chunks);
+    }
+
+    if (table) {
+        SET_Free(table);
+    }
+
+    table            = NULL;
+    tableLength      = 0;
+    threshold        = 0;
+    tableLengthIndex = 0;
+
+    chunks    = NULL;
+    numChunks = 0;
+    maxChunks = 0;
+    count     = 0;
+    numChars  = 0;
+
+    // the indexes are about to be reused
+    memset(recent, 0, sizeof(recent));
+}
+
+inline void con_strpool::rehash(unsigned int newLength)
+{
+    Slot        *oldTable = table;
+    unsigned int i, j;
+
+    table       = (Slot *)SET_Alloc(sizeof(Slot) * newLength);
+    tableLength = newLength;
+    threshold   = newLength - newLength / 4;
+
+    memset(table, 0, sizeof(Slot) * newLength);
+
+    for (tableLengthIndex = 0; (1u << tableLengthIndex) < newLength; tableLengthIndex++) {}
+
+    // the hashes are stored in the entries, the strings aren't read
+    for (i = 1; i <= count; i++) {
+        j = EntryAt(i)->hash >> (32 - tableLengthIndex);
+
+        while (table[j].index) {
+            j = (j + 1) & (tableLength - 1);
+        }
+
+        table[j].hash  = EntryAt(i)->hash;
+        table[j].index = i;
+    }
+
+    if (oldTable) {
+        SET_Free(oldTable);
+    }
+}
+
+inline unsigned int con_strpool::findHashed(const char *s, unsigned int hash) const
+{
+    unsigned int i;
+
+    if (!count) {
+        return 0;
+    }
+
+    for (i = hash >> (32 - tableLengthIndex); table[i].index; i = (i + 1) & (tableLength - 1)) {
+        if (table[i].hash == hash && !strcmp(EntryAt(table[i].index)->string.c_str(), s)) {
+            return table[i].index;
+        }
+    }
+
+    return 0;
+}
+
+inline unsigned int con_strpool::addNew(const str& s, unsigned int hash)
+{
+    Entry       *entry;
+    unsigned int index;
+    unsigned int i;
+
+    if (count >= threshold) {
+        rehash(tableLength ? tableLength * 2 : CON_SET_MIN_LENGTH * 16);
+    }
+
+    index = ++count;
+
+    if (index == (1u << numChunks)) {
+        if (numChunks == maxChunks) {
+            Entry **oldChunks = chunks;
+
+            maxChunks = maxChunks ? maxChunks * 2 : 8;
+            chunks    = (Entry **)SET_Alloc(sizeof(Entry *) * maxChunks);
+
+            if (oldChunks) {
+                memcpy(chunks, oldChunks, sizeof(Entry *) * numChunks);
+                SET_Free(oldChunks);
+            }
+        }
+
+        chunks[numChunks] = (Entry *)SET_Alloc(sizeof(Entry) << numChunks);
+        numChunks++;
+    }
+
+    entry = new (EntryAt(index)) Entry;
+
+    // shares the characters with s
+    entry->string = s;
+    entry->hash   = hash;
+
+    numChars += s.length() + 1;
+
+    for (i = hash >> (32 - tableLengthIndex); table[i].index; i = (i + 1) & (tableLength - 1)) {}
+
+    table[i].hash  = hash;
+    table[i].index = index;
+
+    return index;
+}
+
+inline unsigned int con_strpool::findKeyIndex(const char *s)
+{
+    Recent      *r = RecentSlot(s);
+    unsigned int index;
+
+    numLookups++;
+
+    if (r->pointer == s && r->index) {
+        const char *string = EntryAt(r->index)->string.c_str();
+
+        if (string == s || !strcmp(string, s)) {
+            numRecentHits++;
+            return r->index;
+        }
+    }
+
+    index = findHashed(s, Hash(s));
+    if (index) {
+        r->pointer = s;
+        r->index   = index;
+    }
+
+    return index;
+}
+
+inline unsigned int con_strpool::findKeyIndex(const str& s)
+{
+    return findKeyIndex(s.c_str());
+}
+
+inline unsigned int con_strpool::addKeyIndex(const char *s)
+{
+    unsigned int index;
+    const char  *string;
+
+    index = findKeyIndex(s);
+    if (index) {
+        return index;
+    }
+
+    index  = addNew(str(s), Hash(s));
+    string = EntryAt(index)->string.c_str();
+
+    RecentSlot(s)->pointer      = s;
+    RecentSlot(s)->index        = index;
+    RecentSlot(string)->pointer = string;
+    RecentSlot(string)->index   = index;
+
+    return index;
+}
+
+inline unsigned int con_strpool::addKeyIndex(const str& s)
+{
+    unsigned int index;
+
+    index = findKeyIndex(s.c_str());
+    if (index) {
+        return index;
+    }
+
+    index = addNew(s, Hash(s.c_str()));
+
+    RecentSlot(s.c_str())->pointer = s.c_str();
+    RecentSlot(s.c_str())->index   = index;
+
+    return index;
+}
+
+inline str& con_strpool::operator[](unsigned int index)
+{
+    assert(index >= 1 && index <= count);
+
+    return EntryAt(index)->string;
+}
+
+inline unsigned int con_strpool::size() const
+{
+    return count;
+}
+
+// Bytes used by the table, the entries and the characters
+inline size_t con_strpool::MemoryUsage() const
+{
+    size_t size;
+
+    size = sizeof(Slot) * tableLength;
+    size += numChunks ? sizeof(Entry) * ((1 << numChunks) - 1) : 0;
+    size += sizeof(Entry *) * maxChunks;
+    size += numChars;
+
+    return size;
+}
+
+inline size_t con_strpool::NumLookups() const
+{
+    return numLookups;
+}
+
+inline size_t con_strpool::NumRecentHits() const
+{
+    return numRecentHits;
+}
+
+inline void con_strpool::ResetStats()
+{
+    numLookups    = 0;
+    numRecentHits = 0;
+}
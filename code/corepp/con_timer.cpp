@@ -4,20 +4,119 @@
 #    include "../fgame/archive.h"
 #endif
 
+template<>
+int HashCode<Class *>(Class *const& key)
+{
+    return (int)((size_t)key >> 3);
+}
+
 con_timer::con_timer(void)
 {
-    m_inttime = 0;
-    m_bDirty  = false;
+    m_bHandlesDirty = false;
+    m_sequence      = 0;
+    m_inttime       = 0;
+    m_bDirty        = false;
+}
+
+con_timer::~con_timer()
+{
+    Clear();
+}
+
+void con_timer::Clear(void)
+{
+    int i;
+
+    for (i = m_Elements.NumObjects(); i > 0; i--) {
+        delete m_Elements.ObjectAt(i);
+    }
+
+    m_Elements.Clear();
+    m_Handles.clear();
+    m_bHandlesDirty = false;
+}
+
+int con_timer::CompareSequence(const void *elem1, const void *elem2)
+{
+    const Element *e1 = *(const Element **)elem1;
+    const Element *e2 = *(const Element **)elem2;
+
+    if (e1->sequence < e2->sequence) {
+        return -1;
+    } else if (e1->sequence > e2->sequence) {
+        return 1;
+    }
+
+    return 0;
+}
+
+void con_timer::LinkHandle(Element *element)
+{
+    Element **handle = m_Handles.find(element->obj);
+
+    if (handle) {
+        element->older   = *handle;
+        (*handle)->newer = element;
+        *handle          = element;
+    } else {
+        m_Handles[element->obj] = element;
+    }
+}
+
+void con_timer::UnlinkHandle(Element *element)
+{
+    if (element->newer) {
+        element->newer->older = element->older;
+    } else if (element->older) {
+        m_Handles[element->obj] = element->older;
+    } else {
+        m_Handles.remove(element->obj);
+    }
+
+    if (element->older) {
+        element->older->newer = element->newer;
+    }
+
+    element->older = NULL;
+    element->newer = NULL;
+}
+
+void con_timer::BuildHandles(void)
+{
+    Container<Element *> elements;
+    int                  i;
+
+    // link elements in insertion order so the most recent one is the handle
+    elements.Resize(m_Elements.NumObjects());
+    for (i = 1; i <= m_Elements.NumObjects(); i++) {
+        elements.AddObject(m_Elements.ObjectAt(i));
+    }
+
+    elements.Sort(con_timer::CompareSequence);
+
+    m_Handles.clear();
+    for (i = 1; i <= elements.NumObjects(); i++) {
+        LinkHandle(elements.ObjectAt(i));
+    }
+
+    m_bHandlesDirty = false;
 }
 
 void con_timer::AddElement(Class *e, int inttime)
 {
-    Element element;
+    Element *element;
+
+    if (m_bHandlesDirty) {
+        BuildHandles();
+    }
 
-    element.obj     = e;
-    element.inttime = inttime;
+    element           = new Element;
+    element->obj      = e;
+    element->inttime  = inttime;
+    element->sequence = ++m_sequence;
 
-    m_Elements.AddObject(element);
+    m_Elements.Add(element);
+    LinkHandle(element);
 
     if (inttime <= m_inttime) {
         SetDirty();
@@ -26,37 +125,46 @@ void con_timer::AddElement(Class *e, int inttime)
 
 void con_timer::RemoveElement(Class *e)
 {
-    for (int i = m_Elements.NumObjects(); i > 0; i--) {
-        Element *index = &m_Elements.ObjectAt(i);
+    Element **handle;
+    Element  *element;
 
-        if (index->obj == e) {
-            m_Elements.RemoveObjectAt(i);
-            return;
-        }
+    if (m_bHandlesDirty) {
+        BuildHandles();
     }
+
+    handle = m_Handles.find(e);
+    if (!handle) {
+        return;
+    }
+
+    // the most recently added element of the object is removed
+    element = *handle;
+
+    UnlinkHandle(element);
+    m_Elements.Remove(element);
+
+    delete element;
 }
 
 Class *con_timer::GetNextElement(int& foundtime)
 {
-    int    best_inttime;
-    int    i;
-    int    foundIndex;
-    Class *result;
+    Element *element;
+    Class   *result;
 
-    foundIndex   = 0;
-    best_inttime = m_inttime;
-
-    for (i = m_Elements.NumObjects(); i > 0; i--) {
-        if (m_Elements.ObjectAt(i).inttime <= best_inttime) {
-            best_inttime = m_Elements.ObjectAt(i).inttime;
-            foundIndex   = i;
-        }
+    if (m_bHandlesDirty) {
+        BuildHandles();
     }
 
-    if (foundIndex) {
-        result = m_Elements.ObjectAt(foundIndex).obj;
-        m_Elements.RemoveObjectAt(foundIndex);
-        foundtime = best_inttime;
+    element = m_Elements.Top();
+
+    if (element && element->inttime <= m_inttime) {
+        result    = element->obj;
+        foundtime = element->inttime;
+
+        UnlinkHandle(element);
+        m_Elements.Remove(element);
+
+        delete element;
     } else {
         result   = NULL;
         m_bDirty = false;
@@ -67,17 +175,51 @@ Class *con_timer::GetNextElement(int& foundtime)
 
 #if defined(ARCHIVE_SUPPORTED)
 
-void con_timer::ArchiveElement(Archiver& arc, Element *e)
-{
-    arc.ArchiveObjectPointer(&e->obj);
-    arc.ArchiveInteger(&e->inttime);
-}
-
 void con_timer::Archive(Archiver& arc)
 {
+    Container<Element *> elements;
+    Element             *element;
+    int                  num;
+    int                  i;
+
     arc.ArchiveBool(&m_bDirty);
     arc.ArchiveInteger(&m_inttime);
 
-    m_Elements.Archive(arc, con_timer::ArchiveElement);
+    //
+    // Same layout as the Container of elements used before the heap,
+    // elements are written in insertion order
+    //
+    if (arc.Loading()) {
+        Clear();
+
+        arc.ArchiveInteger(&num);
+        for (i = 0; i < num; i++) {
+            element = new Element;
+
+            arc.ArchiveObjectPointer(&element->obj);
+            arc.ArchiveInteger(&element->inttime);
+            element->sequence = ++m_sequence;
+
+            m_Elements.Add(element);
+        }
+
+        // object pointers are fixed up when the archive is closed
+        m_bHandlesDirty = true;
+    } else {
+        num = m_Elements.NumObjects();
+        for (i = 1; i <= num; i++) {
+            elements.AddObject(m_Elements.ObjectAt(i));
+        }
+
+        elements.Sort(con_timer::CompareSequence);
+
+        arc.ArchiveInteger(&num);
+        for (i = 1; i <= num; i++) {
+            element = elements.ObjectAt(i);
+
+            arc.ArchiveObjectPointer(&element->obj);
+            arc.ArchiveInteger(&element->inttime);
+        }
+    }
 }
 #endif
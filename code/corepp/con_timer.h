@@ -1,4 +1,5 @@
 #include "../corepp/class.h"
+#include "../corepp/con_heap.h"
 
 class con_timer : public Class
 {
@@ -8,15 +9,39 @@ public:
     public:
         Class *obj;
         int    inttime;
+
+        // insertion order, elements with the same time are returned first in, first out
+        long long sequence;
+        int       heapIndex;
+
+        // other elements of the same object, from the most recently added
+        Element *older;
+        Element *newer;
+
+        Element();
+
+        bool operator<(const Element& other) const;
     };
 
 private:
-    Container<con_timer::Element> m_Elements;
-    bool                          m_bDirty;
-    int                           m_inttime;
+    con_heap<con_timer::Element>           m_Elements;
+    con_map<Class *, con_timer::Element *> m_Handles;
+    bool                                   m_bHandlesDirty;
+    long long                              m_sequence;
+    bool                                   m_bDirty;
+    int                                    m_inttime;
+
+private:
+    static int CompareSequence(const void *elem1, const void *elem2);
+
+    void LinkHandle(Element *element);
+    void UnlinkHandle(Element *element);
+    void BuildHandles(void);
+    void Clear(void);
 
 public:
     con_timer();
+    ~con_timer();
 
     void AddElement(Class *e, int inttime);
     void RemoveElement(Class *e);
@@ -28,11 +53,25 @@ public:
     void SetTime(int inttime);
 
 #if defined(ARCHIVE_SUPPORTED)
-    static void ArchiveElement(class Archiver& arc, Element *e);
-    void        Archive(class Archiver       &arc) override;
+    void Archive(class Archiver& arc) override;
 #endif
 };
 
+inline con_timer::Element::Element()
+{
+    obj       = NULL;
+    inttime   = 0;
+    sequence  = 0;
+    heapIndex = 0;
+    older     = NULL;
+    newer     = NULL;
+}
+
+inline bool con_timer::Element::operator<(const Element& other) const
+{
+    return inttime < other.inttime || (inttime == other.inttime && sequence < other.sequence);
+}
+
 inline void con_timer::SetDirty(void)
 {
     m_bDirty = true;
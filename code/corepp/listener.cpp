@@ -25,6 +25,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../script/scriptvariable.h"
 #include "../script/scriptexception.h"
 #include "Linklist.h"
+#include "mem_tempalloc.h"
 
 #ifdef WITH_SCRIPT_ENGINE
 #    include "../fgame/archive.h"
@@ -57,7 +58,14 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <utility>
 #include <algorithm>
 
+static_assert(sizeof(ScriptVariable) <= EVENT_INLINE_VARIABLE_SIZE, "EVENT_INLINE_VARIABLE_SIZE is too small");
+static_assert(alignof(ScriptVariable) <= 8, "Event inline data is not aligned for ScriptVariable");
+
 DataNode                          *Event::DataNodeList = NULL;
+size_t                             Event::numInlineData    = 0;
+size_t                             Event::numFrameData     = 0;
+size_t                             Event::numHeapData      = 0;
+size_t                             Event::numLiveFrameData = 0;
 con_map<Event *, EventDef>         Event::eventDefList;
 con_arrayset<command_t, command_t> Event::commandList;
 
@@ -70,7 +78,67 @@ con_map<const_str, unsigned int> Event::setterCommandList;
 
 #endif
 
-EventQueueNode Event::EventQueue;
+con_heap<EventQueueNode> Event::EventQueue;
+
+//
+// Pending events are dispatched by inttime, then by sequence.
+// A newly posted event runs before the events already queued for the same time,
+// while postponed and unarchived events run after them.
+//
+static long long eventQueueFrontSequence = 0;
+static long long eventQueueBackSequence  = 0;
+
+// Argument lists of transient events, rewound when none is left
+static MEM_TempAlloc L_FrameAllocator(EVENT_FRAME_BLOCK_SIZE);
+
+static void L_LinkSourceEvent(EventQueueNode *node)
+{
+    Listener *obj = node->GetSourceObject();
+
+    LL_SafeAddFirst(obj->m_PendingEvents, node, sourceNext, sourcePrev);
+}
+
+static void L_UnlinkSourceEvent(EventQueueNode *node)
+{
+    Listener *obj = node->GetSourceObject();
+
+    if (!obj) {
+        // unarchived event that isn't linked yet
+        return;
+    }
+
+    LL_SafeRemoveRoot(obj->m_PendingEvents, node, sourceNext, sourcePrev);
+
+    node->sourcePrev = NULL;
+    node->sourceNext = NULL;
+}
+
+static void L_RemoveEvent(EventQueueNode *node)
+{
+    Event::EventQueue.Remove(node);
+    L_UnlinkSourceEvent(node);
+}
+
+static void L_QueueEventFront(EventQueueNode *node)
+{
+    node->sequence = --eventQueueFrontSequence;
+    Event::EventQueue.Add(node);
+    L_LinkSourceEvent(node);
+}
+
+#if defined(ARCHIVE_SUPPORTED)
+static void L_QueueEventBack(EventQueueNode *node)
+{
+    node->sequence = ++eventQueueBackSequence;
+    Event::EventQueue.Add(node);
+}
+#endif
+
+static void L_RequeueEventBack(EventQueueNode *node)
+{
+    node->sequence = ++eventQueueBackSequence;
+    Event::EventQueue.Update(node);
+}
 
 int DisableListenerNotify = 0;
 
@@ -449,7 +517,7 @@ void Event::Archive(Archiver& arc)
     arc.ArchiveUnsignedShort(&dataSize);
 
     if (arc.Loading()) {
-        data = new ScriptVariable[dataSize + 1];
+        AllocData(dataSize + 1);
     }
 
     for (int i = dataSize; i > 0; i--) {
@@ -457,15 +525,33 @@ void Event::Archive(Archiver& arc)
     }
 }
 
+static int L_CompareEventQueueNodes(const void *elem1, const void *elem2)
+{
+    const EventQueueNode *node1 = *(const EventQueueNode **)elem1;
+    const EventQueueNode *node2 = *(const EventQueueNode **)elem2;
+
+    if (*node1 < *node2) {
+        return -1;
+    } else if (*node2 < *node1) {
+        return 1;
+    }
+
+    return 0;
+}
+
 void L_ArchiveEvents(Archiver& arc)
 {
-    EventQueueNode *event;
-    int             num;
+    Container<EventQueueNode *> events;
+    EventQueueNode             *event;
+    int                         num;
+    int                         i;
 
     num = 0;
-    for (event = Event::EventQueue.next; event != &Event::EventQueue; event = event->next) {
+    for (i = 1; i <= Event::EventQueue.NumObjects(); i++) {
         Listener *obj;
 
+        event = Event::EventQueue.ObjectAt(i);
+
         assert(event);
 
         obj = event->GetSourceObject();
@@ -478,24 +564,16 @@ void L_ArchiveEvents(Archiver& arc)
         }
 #    endif
 
+        events.AddObject(event);
         num++;
     }
 
-    arc.ArchiveInteger(&num);
-    for (event = Event::EventQueue.next; event != &Event::EventQueue; event = event->next) {
-        Listener *obj;
-
-        assert(event);
-
-        obj = event->GetSourceObject();
-
-        assert(obj);
+    // the heap isn't sorted, save events in the order they would be processed
+    events.Sort(L_CompareEventQueueNodes);
 
-#    if defined(GAME_DLL)
-        if (obj->isSubclassOf(Entity) && (((Entity *)obj)->flags & FL_DONTSAVE)) {
-            continue;
-        }
-#    endif
+    arc.ArchiveInteger(&num);
+    for (i = 1; i <= num; i++) {
+        event = events.ObjectAt(i);
 
         event->event->Archive(arc);
         arc.ArchiveInteger(&event->inttime);
@@ -523,25 +601,66 @@ void L_UnarchiveEvents(Archiver& arc)
         arc.ArchiveInteger(&node->flags);
         arc.ArchiveSafePointer(&node->m_sourceobject);
 
-        LL_Add(&Event::EventQueue, node, next, prev);
+        // the source object is only known once the archive is closed,
+        // see L_LinkUnarchivedEvents
+        L_QueueEventBack(node);
+    }
+}
+
+void L_LinkUnarchivedEvents(void)
+{
+    Container<EventQueueNode *> orphans;
+    EventQueueNode             *node;
+    Listener                   *obj;
+    int                         i;
+
+    for (i = Event::EventQueue.NumObjects(); i > 0; i--) {
+        node = Event::EventQueue.ObjectAt(i);
+        obj  = node->GetSourceObject();
+
+        if (!obj) {
+            orphans.AddObject(node);
+            continue;
+        }
+
+        if (!node->sourcePrev && obj->m_PendingEvents != node) {
+            L_LinkSourceEvent(node);
+        }
+    }
+
+    for (i = 1; i <= orphans.NumObjects(); i++) {
+        node = orphans.ObjectAt(i);
+
+        Event::EventQueue.Remove(node);
+        delete node->event;
+        delete node;
     }
 }
 #endif
 
 void L_ClearEventList()
 {
-    EventQueueNode *node = Event::EventQueue.next, *tmp;
+    EventQueueNode *node;
+    int             i;
 
-    while (node != &Event::EventQueue) {
-        tmp = node->next;
+    for (i = Event::EventQueue.NumObjects(); i > 0; i--) {
+        Listener *obj;
+
+        node = Event::EventQueue.ObjectAt(i);
+        obj  = node->GetSourceObject();
+
+        if (obj) {
+            obj->m_PendingEvents = NULL;
+        }
 
         delete node->event;
         delete node;
-
-        node = tmp;
     }
 
-    LL_Reset(&Event::EventQueue, next, prev);
+    Event::EventQueue.Clear();
+
+    eventQueueFrontSequence = 0;
+    eventQueueBackSequence  = 0;
 
     Event_allocator.FreeAll();
 
@@ -567,8 +686,6 @@ void L_InitEvents(void)
     Event::LoadEvents();
     ClassDef::BuildEventResponses();
 
-    LL_Reset(&Event::EventQueue, next, prev);
-
     L_ClearEventList();
     Listener::EventSystemStarted = true;
 }
@@ -580,13 +697,9 @@ void L_ProcessPendingEvents()
     Listener::ProcessingEvents = true;
 
     int t = EVENT_msec;
-    while (!LL_Empty(&Event::EventQueue, next, prev)) {
+    while ((node = Event::EventQueue.Top()) != NULL) {
         Listener *obj;
 
-        node = Event::EventQueue.next;
-
-        assert(node);
-
         obj = node->GetSourceObject();
 
         assert(obj);
@@ -596,7 +709,7 @@ void L_ProcessPendingEvents()
         }
 
         // the event is removed from its list
-        LL_Remove(node, next, prev);
+        L_RemoveEvent(node);
         //gi.DPrintf2("Event: %s\n", node->event->getName().c_str());
 
         // ProcessEvent will dispose of this event when it is done
@@ -608,6 +721,19 @@ void L_ProcessPendingEvents()
     Listener::ProcessingEvents = false;
 }
 
+// Called once per frame, transient events must not be alive by then
+void L_ResetFrameEvents(void)
+{
+    if (Event::numLiveFrameData) {
+        // keep the arguments valid, the arena is rewound when they are freed
+        EVENT_DPrintf("^~^~^ %zu transient event argument lists outlived their frame\n", Event::numLiveFrameData);
+        assert(!"transient event outlived its frame");
+        return;
+    }
+
+    L_FrameAllocator.Reset();
+}
+
 void L_ShutdownEvents(void)
 {
     if (!Listener::EventSystemStarted) {
@@ -616,6 +742,10 @@ void L_ShutdownEvents(void)
 
     L_ClearEventList();
 
+    if (!Event::numLiveFrameData) {
+        L_FrameAllocator.FreeAll();
+    }
+
     Event::commandList.clear();
     Event::eventDefList.clear();
 #ifdef WITH_SCRIPT_ENGINE
@@ -1842,15 +1972,17 @@ void Event::PendingEvents(const char *mask)
     EventQueueNode *event;
     size_t          l;
     int             num;
+    int             i;
 
     l = 0;
     if (mask) {
         l = strlen(mask);
     }
 
-    num   = 0;
-    event = EventQueue.next;
-    while (event != &EventQueue) {
+    num = 0;
+    for (i = 1; i <= EventQueue.NumObjects(); i++) {
+        event = EventQueue.ObjectAt(i);
+
         assert(event);
         assert(event->m_sourceobject);
 
@@ -1858,8 +1990,6 @@ void Event::PendingEvents(const char *mask)
             num++;
             //Event::PrintEvent( event );
         }
-
-        event = event->next;
     }
     EVENT_Printf("%d pending events as of %.2f\n", num, EVENT_time);
 }
@@ -1945,7 +2075,7 @@ FindNormalEventNum
 unsigned int Event::FindNormalEventNum(str s)
 {
     s.tolower();
-    return FindNormalEventNum(Director.AddString(s));
+    return FindNormalEventNum(Director.GetString(s));
 }
 
 /*
@@ -1956,7 +2086,7 @@ FindReturnEventNum
 unsigned int Event::FindReturnEventNum(str s)
 {
     s.tolower();
-    return FindReturnEventNum(Director.AddString(s));
+    return FindReturnEventNum(Director.GetString(s));
 }
 
 /*
@@ -1966,7 +2096,7 @@ FindSetterEventNum
 */
 unsigned int Event::FindSetterEventNum(str s)
 {
-    return FindSetterEventNum(Director.AddString(s));
+    return FindSetterEventNum(Director.GetString(s));
 }
 
 /*
@@ -1976,7 +2106,7 @@ FindGetterEventNum
 */
 unsigned int Event::FindGetterEventNum(str s)
 {
-    return FindGetterEventNum(Director.AddString(s));
+    return FindGetterEventNum(Director.GetString(s));
 }
 
 /*
@@ -2180,6 +2310,7 @@ Event::Event()
     data        = NULL;
     dataSize    = 0;
     maxDataSize = 0;
+    transient   = false;
 
 #ifdef _DEBUG
     name = NULL;
@@ -2217,6 +2348,7 @@ Event::Event(
     fromScript  = false;
     dataSize    = 0;
     maxDataSize = 0;
+    transient   = false;
     data        = NULL;
     eventnum    = 0;
 
@@ -2235,16 +2367,16 @@ Event::Event(const Event& ev)
     fromScript  = ev.fromScript;
     eventnum    = ev.eventnum;
     dataSize    = ev.dataSize;
-    maxDataSize = ev.maxDataSize;
+    maxDataSize = 0;
+    transient   = false;
+    data        = NULL;
 
     if (dataSize) {
-        data = new ScriptVariable[maxDataSize];
+        AllocData(ev.maxDataSize > dataSize ? ev.maxDataSize : dataSize);
 
         for (int i = 0; i < dataSize; i++) {
             data[i] = ev.data[i];
         }
-    } else {
-        data = NULL;
     }
 
 #ifdef _DEBUG
@@ -2257,18 +2389,18 @@ Event::Event(const Event& ev, int numArgs)
     fromScript  = ev.fromScript;
     eventnum    = ev.eventnum;
     dataSize    = ev.dataSize;
-    maxDataSize = ev.maxDataSize;
+    maxDataSize = 0;
+    transient   = false;
+    data        = NULL;
 
     if (dataSize) {
-        data = new ScriptVariable[maxDataSize];
+        AllocData(ev.maxDataSize > dataSize ? ev.maxDataSize : dataSize);
 
         for (int i = 0; i < dataSize; i++) {
             data[i] = ev.data[i];
         }
     } else {
-        data        = new ScriptVariable[numArgs];
-        dataSize    = 0;
-        maxDataSize = numArgs;
+        AllocData(numArgs);
     }
 
 #ifdef _DEBUG
@@ -2280,18 +2412,18 @@ Event::Event(Event&& ev)
 {
     fromScript  = ev.fromScript;
     eventnum    = ev.eventnum;
-    dataSize    = ev.dataSize;
-    maxDataSize = ev.maxDataSize;
-    data        = ev.data;
+    dataSize    = 0;
+    maxDataSize = 0;
+    transient   = false;
+    data        = NULL;
+
+    MoveData(ev);
 
 #ifdef _DEBUG
     name = ev.name;
 #endif
 
-    ev.data        = NULL;
-    ev.dataSize    = 0;
-    ev.maxDataSize = 0;
-    ev.eventnum    = 0;
+    ev.eventnum = 0;
 
 #ifdef _DEBUG
     ev.name = NULL;
@@ -2312,6 +2444,7 @@ Event::Event(int index)
     data        = NULL;
     dataSize    = 0;
     maxDataSize = 0;
+    transient   = false;
 
 #ifdef _DEBUG
     name = GetEventName(index);
@@ -2329,9 +2462,12 @@ Event::Event(int index, int numArgs)
 {
     fromScript  = false;
     eventnum    = index;
-    data        = new ScriptVariable[numArgs];
+    data        = NULL;
     dataSize    = 0;
-    maxDataSize = numArgs;
+    maxDataSize = 0;
+    transient   = false;
+
+    AllocData(numArgs);
 
 #ifdef _DEBUG
     name = GetEventName(index);
@@ -2354,6 +2490,7 @@ Event::Event(const char *command)
 
     fromScript  = qfalse;
     maxDataSize = 0;
+    transient   = false;
     dataSize    = 0;
     data        = NULL;
 
@@ -2377,15 +2514,12 @@ Event::Event(const char *command, int numArgs)
     }
 
     fromScript  = qfalse;
-    maxDataSize = numArgs;
+    maxDataSize = 0;
+    transient   = false;
+    dataSize    = 0;
+    data        = NULL;
 
-    if (numArgs) {
-        data     = new ScriptVariable[numArgs];
-        dataSize = 0;
-    } else {
-        dataSize = 0;
-        data     = NULL;
-    }
+    AllocData(numArgs);
 
 #ifdef _DEBUG
     name = command;
@@ -2404,20 +2538,22 @@ Event::~Event()
 
 Event& Event::operator=(const Event& ev)
 {
+    if (&ev == this) {
+        return *this;
+    }
+
     Clear();
-    fromScript  = ev.fromScript;
-    eventnum    = ev.eventnum;
-    dataSize    = ev.dataSize;
-    maxDataSize = ev.maxDataSize;
+    fromScript = ev.fromScript;
+    eventnum   = ev.eventnum;
 
-    if (dataSize) {
-        data = new ScriptVariable[dataSize];
+    if (ev.dataSize) {
+        AllocData(ev.maxDataSize > ev.dataSize ? ev.maxDataSize : ev.dataSize);
 
-        for (int i = 0; i < dataSize; i++) {
+        for (int i = 0; i < ev.dataSize; i++) {
             data[i] = ev.data[i];
         }
-    } else {
-        data = NULL;
+
+        dataSize = ev.dataSize;
     }
 
 #ifdef _DEBUG
@@ -2429,21 +2565,21 @@ Event& Event::operator=(const Event& ev)
 
 Event& Event::operator=(Event&& ev)
 {
+    if (&ev == this) {
+        return *this;
+    }
+
     Clear();
-    fromScript  = ev.fromScript;
-    eventnum    = ev.eventnum;
-    dataSize    = ev.dataSize;
-    maxDataSize = ev.maxDataSize;
-    data        = ev.data;
+    fromScript = ev.fromScript;
+    eventnum   = ev.eventnum;
+
+    MoveData(ev);
 
 #ifdef _DEBUG
     name = ev.name;
 #endif
 
-    ev.data        = NULL;
-    ev.dataSize    = 0;
-    ev.maxDataSize = 0;
-    ev.eventnum    = 0;
+    ev.eventnum = 0;
 
 #ifdef _DEBUG
     ev.name = NULL;
@@ -2631,12 +2767,302 @@ Clear
 void Event::Clear(void)
 {
     if (data) {
-        delete[] data;
+        FreeData();
+    }
+}
+
+/*
+=======================
+InlineData
+=======================
+*/
+ScriptVariable *Event::InlineData(void)
+{
+    return reinterpret_cast<ScriptVariable *>(inlineData);
+}
+
+/*
+=======================
+AllocData
 
+Allocates an empty argument list, the event must not have any argument
+=======================
+*/
+void Event::AllocData(int numArgs)
+{
+    int i;
+
+    assert(!data);
+
+    if (numArgs <= 0) {
         data        = NULL;
-        dataSize    = 0;
         maxDataSize = 0;
+        return;
+    }
+
+    if (numArgs <= EVENT_INLINE_ARGS) {
+        data = InlineData();
+        for (i = 0; i < numArgs; i++) {
+            new (data + i) ScriptVariable();
+        }
+
+        numInlineData++;
+    } else {
+        data = NewData(numArgs);
+    }
+
+    maxDataSize = numArgs;
+}
+
+/*
+=======================
+GrowData
+
+Increases the capacity of the argument list, keeping existing arguments
+=======================
+*/
+void Event::GrowData(int numArgs)
+{
+    ScriptVariable *oldData;
+    int             i;
+
+    if (!data) {
+        AllocData(numArgs);
+        return;
+    }
+
+    if (data == InlineData()) {
+        if (numArgs <= EVENT_INLINE_ARGS) {
+            // still fits in the event
+            for (i = maxDataSize; i < numArgs; i++) {
+                new (data + i) ScriptVariable();
+            }
+
+            maxDataSize = numArgs;
+            return;
+        }
+
+        oldData = data;
+        data    = NewData(numArgs);
+
+        for (i = 0; i < dataSize; i++) {
+            data[i] = std::move(oldData[i]);
+        }
+
+        for (i = 0; i < maxDataSize; i++) {
+            oldData[i].~ScriptVariable();
+        }
+    } else {
+        oldData = data;
+        data    = NewData(numArgs);
+
+        for (i = 0; i < dataSize; i++) {
+            data[i] = std::move(oldData[i]);
+        }
+
+        DeleteData(oldData, maxDataSize);
     }
+
+    maxDataSize = numArgs;
+}
+
+/*
+=======================
+MoveData
+
+Takes the arguments of the specified event, the event must not have any argument
+=======================
+*/
+void Event::MoveData(Event& ev)
+{
+    int i;
+
+    assert(!data);
+
+    if (!ev.data) {
+        return;
+    }
+
+    if (ev.data == ev.InlineData() || ev.transient != transient) {
+        // the storage can't be taken over, the arguments are moved one by one
+        AllocData(ev.maxDataSize);
+        for (i = 0; i < ev.dataSize; i++) {
+            data[i] = std::move(ev.data[i]);
+        }
+
+        dataSize = ev.dataSize;
+
+        ev.FreeData();
+        return;
+    }
+
+    data        = ev.data;
+    dataSize    = ev.dataSize;
+    maxDataSize = ev.maxDataSize;
+
+    ev.data        = NULL;
+    ev.dataSize    = 0;
+    ev.maxDataSize = 0;
+}
+
+/*
+=======================
+FreeData
+=======================
+*/
+void Event::FreeData(void)
+{
+    int i;
+
+    if (data == InlineData()) {
+        for (i = 0; i < maxDataSize; i++) {
+            data[i].~ScriptVariable();
+        }
+    } else {
+        DeleteData(data, maxDataSize);
+    }
+
+    data        = NULL;
+    dataSize    = 0;
+    maxDataSize = 0;
+}
+
+/*
+=======================
+NewData
+
+Allocates an argument list that doesn't fit in the event
+=======================
+*/
+ScriptVariable *Event::NewData(int numArgs)
+{
+    ScriptVariable *newData;
+    int             i;
+
+    if (!transient) {
+        numHeapData++;
+        return new ScriptVariable[numArgs];
+    }
+
+    newData = (ScriptVariable *)L_FrameAllocator.Alloc(sizeof(ScriptVariable) * numArgs, alignof(ScriptVariable));
+    for (i = 0; i < numArgs; i++) {
+        new (newData + i) ScriptVariable();
+    }
+
+    numFrameData++;
+    numLiveFrameData++;
+
+    return newData;
+}
+
+/*
+=======================
+DeleteData
+
+Frees an argument list allocated by NewData
+=======================
+*/
+void Event::DeleteData(ScriptVariable *oldData, int numArgs)
+{
+    int i;
+
+    if (!transient) {
+        delete[] oldData;
+        return;
+    }
+
+    for (i = 0; i < numArgs; i++) {
+        oldData[i].~ScriptVariable();
+    }
+
+#ifdef _DEBUG
+    memset((void *)oldData, 0xDD, sizeof(ScriptVariable) * numArgs);
+#endif
+
+    assert(numLiveFrameData);
+    numLiveFrameData--;
+
+    if (!numLiveFrameData) {
+        // nothing left in the arena, rewind it
+        L_FrameAllocator.Reset();
+    }
+}
+
+/*
+=======================
+DataStats
+
+Prints how argument lists were stored
+=======================
+*/
+void Event::DataStats(bool reset)
+{
+    size_t total = numInlineData + numFrameData + numHeapData;
+
+    EVENT_Printf(
+        "%zu argument lists: %zu stored in events, %zu in the frame arena, %zu allocated (%.1f%%)\n",
+        total,
+        numInlineData,
+        numFrameData,
+        numHeapData,
+        total ? numHeapData * 100.0 / total : 0.0
+    );
+
+    if (reset) {
+        numInlineData = 0;
+        numFrameData  = 0;
+        numHeapData   = 0;
+    }
+}
+
+/*
+=======================
+TransientEvent
+=======================
+*/
+TransientEvent::TransientEvent(int index)
+    : Event(index)
+{
+    transient = true;
+}
+
+/*
+=======================
+TransientEvent
+=======================
+*/
+TransientEvent::TransientEvent(int index, int numArgs)
+    : Event(index)
+{
+    transient = true;
+
+    AllocData(numArgs);
+}
+
+/*
+=======================
+TransientEvent
+=======================
+*/
+TransientEvent::TransientEvent(const Event& ev)
+    : Event(ev.eventnum)
+{
+    transient  = true;
+    fromScript = ev.fromScript;
+
+    if (ev.dataSize) {
+        AllocData(ev.maxDataSize > ev.dataSize ? ev.maxDataSize : ev.dataSize);
+
+        for (int i = 0; i < ev.dataSize; i++) {
+            data[i] = ev.data[i];
+        }
+
+        dataSize = ev.dataSize;
+    }
+
+#ifdef _DEBUG
+    name = ev.name;
+#endif
 }
 
 /*
@@ -2790,34 +3216,19 @@ GetValue
 */
 ScriptVariable& Event::GetValue(void)
 {
-    ScriptVariable *tmp;
-    int             i;
-
     if (fromScript) {
         // an event method will emit the return value
         // to the first index of the array
         // so there is no reallocation
         if (!data) {
-            data        = new ScriptVariable[1];
-            dataSize    = 1;
-            maxDataSize = 1;
+            AllocData(1);
+            dataSize = 1;
         }
         return data[0];
     }
 
     if (dataSize == maxDataSize) {
-        tmp = data;
-
-        maxDataSize += 3;
-        data = new ScriptVariable[maxDataSize];
-
-        if (tmp != NULL) {
-            for (i = 0; i < dataSize; i++) {
-                data[i] = std::move(tmp[i]);
-            }
-
-            delete[] tmp;
-        }
+        GrowData(maxDataSize + 3);
     }
 
     dataSize++;
@@ -3006,6 +3417,8 @@ Listener
 */
 Listener::Listener()
 {
+    m_PendingEvents = NULL;
+
 #ifdef WITH_SCRIPT_ENGINE
 
     m_EndList = NULL;
@@ -3126,17 +3539,14 @@ void Listener::CancelEventsOfType(Event *ev)
     EventQueueNode *next;
     int             eventnum;
 
-    node = Event::EventQueue.next;
-
     eventnum = ev->eventnum;
-    while (node != &Event::EventQueue) {
-        next = node->next;
-        if ((node->GetSourceObject() == this) && (node->event->eventnum == eventnum)) {
-            LL_Remove(node, next, prev);
+    for (node = m_PendingEvents; node; node = next) {
+        next = node->sourceNext;
+        if (node->event->eventnum == eventnum) {
+            L_RemoveEvent(node);
             delete node->event;
             delete node;
         }
-        node = next;
     }
 }
 
@@ -3160,12 +3570,10 @@ void Listener::CancelFlaggedEvents(int flags)
     EventQueueNode *node;
     EventQueueNode *next;
 
-    node = Event::EventQueue.next;
-
-    while (node != &Event::EventQueue) {
-        next = node->next;
-        if ((node->GetSourceObject() == this) && (node->flags & flags)) {
-            LL_Remove(node, next, prev);
+    for (node = m_PendingEvents; node; node = next) {
+        next = node->sourceNext;
+        if (node->flags & flags) {
+            L_RemoveEvent(node);
             // Added in OPM
             //  Original doesn't delete the posted Event
             //  which would cause a memory leak
@@ -3173,7 +3581,6 @@ void Listener::CancelFlaggedEvents(int flags)
 
             delete node;
         }
-        node = next;
     }
 }
 
@@ -3185,18 +3592,11 @@ CancelPendingEvents
 void Listener::CancelPendingEvents(void)
 {
     EventQueueNode *node;
-    EventQueueNode *next;
 
-    node = Event::EventQueue.next;
-
-    while (node != &Event::EventQueue) {
-        next = node->next;
-        if (node->GetSourceObject() == this) {
-            LL_Remove(node, next, prev);
-            delete node->event;
-            delete node;
-        }
-        node = next;
+    while ((node = m_PendingEvents) != NULL) {
+        L_RemoveEvent(node);
+        delete node->event;
+        delete node;
     }
 }
 
@@ -3210,16 +3610,12 @@ qboolean Listener::EventPending(Event& ev)
     EventQueueNode *event;
     int             eventnum;
 
-    event = Event::EventQueue.next;
-
     eventnum = ev.eventnum;
 
-    while (event != &Event::EventQueue) {
-        if ((event->GetSourceObject() == this) && (event->event->eventnum == ev.eventnum)) {
+    for (event = m_PendingEvents; event; event = event->sourceNext) {
+        if (event->event->eventnum == eventnum) {
             return true;
         }
-
-        event = event->next;
     }
 
     return false;
@@ -3233,8 +3629,6 @@ PostEventInternal
 EventQueueNode *Listener::PostEventInternal(Event *ev, float delay, int flags)
 {
     EventQueueNode *node;
-    EventQueueNode *i;
-    int             inttime;
 
 #if defined(GAME_DLL)
     if (LoadingSavegame) {
@@ -3257,14 +3651,7 @@ EventQueueNode *Listener::PostEventInternal(Event *ev, float delay, int flags)
 
     node = new EventQueueNode;
 
-    i       = Event::EventQueue.next;
-    inttime = EVENT_msec + (delay * 1000.0f + 0.5f);
-
-    while (i != &Event::EventQueue && inttime > i->inttime) {
-        i = i->next;
-    }
-
-    node->inttime = inttime;
+    node->inttime = EVENT_msec + (delay * 1000.0f + 0.5f);
     node->event   = ev;
     node->flags   = flags;
     node->SetSourceObject(this);
@@ -3273,7 +3660,7 @@ EventQueueNode *Listener::PostEventInternal(Event *ev, float delay, int flags)
     node->name = ev->name;
 #endif
 
-    LL_Add(i, node, next, prev);
+    L_QueueEventFront(node);
 
     return node;
 }
@@ -3308,27 +3695,24 @@ PostponeAllEvents
 qboolean Listener::PostponeAllEvents(float time)
 {
     EventQueueNode *event;
-    EventQueueNode *node;
+    EventQueueNode *first;
 
-    event = Event::EventQueue.next;
-    while (event != &Event::EventQueue) {
-        if (event->GetSourceObject() == this) {
-            event->inttime += time * 1000.0f + 0.5f;
-
-            node = event->next;
-            while ((node != &Event::EventQueue) && (event->inttime >= node->inttime)) {
-                node = node->next;
-            }
-
-            LL_Remove(event, next, prev);
-            LL_Add(node, event, next, prev);
-
-            return true;
+    // only the first pending event of this listener is postponed
+    first = NULL;
+    for (event = m_PendingEvents; event; event = event->sourceNext) {
+        if (!first || *event < *first) {
+            first = event;
         }
-        event = event->next;
     }
 
-    return false;
+    if (!first) {
+        return false;
+    }
+
+    first->inttime += time * 1000.0f + 0.5f;
+    L_RequeueEventBack(first);
+
+    return true;
 }
 
 /*
@@ -3339,30 +3723,26 @@ PostponeEvent
 qboolean Listener::PostponeEvent(Event& ev, float time)
 {
     EventQueueNode *event;
-    EventQueueNode *node;
+    EventQueueNode *first;
     int             eventnum;
 
     eventnum = ev.eventnum;
 
-    event = Event::EventQueue.next;
-    while (event != &Event::EventQueue) {
-        if ((event->GetSourceObject() == this) && (event->event->eventnum == eventnum)) {
-            event->inttime += time * 1000.0f + 0.5f;
-
-            node = event->next;
-            while ((node != &Event::EventQueue) && (event->inttime >= node->inttime)) {
-                node = node->next;
-            }
-
-            LL_Remove(event, next, prev);
-            LL_Add(node, event, next, prev);
-
-            return true;
+    first = NULL;
+    for (event = m_PendingEvents; event; event = event->sourceNext) {
+        if ((event->event->eventnum == eventnum) && (!first || *event < *first)) {
+            first = event;
         }
-        event = event->next;
     }
 
-    return false;
+    if (!first) {
+        return false;
+    }
+
+    first->inttime += time * 1000.0f + 0.5f;
+    L_RequeueEventBack(first);
+
+    return true;
 }
 
 /*
@@ -3407,7 +3787,7 @@ ProcessEvent
 bool Listener::ProcessEvent(const Event& ev)
 {
     try {
-        Event event(ev);
+        TransientEvent event(ev);
         return ProcessScriptEvent(event);
     } catch (ScriptException& exc) {
         ev.ErrorInternal(this, exc.string);
@@ -3532,8 +3912,9 @@ ProcessPendingEvents
 qboolean Listener::ProcessPendingEvents(void)
 {
     EventQueueNode *event;
+    EventQueueNode *first;
     qboolean        processedEvents;
-    float           t;
+    int             t;
 
     processedEvents = false;
 
@@ -3541,36 +3922,28 @@ qboolean Listener::ProcessPendingEvents(void)
 
     Listener::ProcessingEvents = true;
 
-    event = Event::EventQueue.next;
-    while (event != &Event::EventQueue) {
-        Listener *obj;
-
-        assert(event);
-
-        obj = event->GetSourceObject();
+    for (;;) {
+        // find the earliest due event of this listener
+        first = NULL;
+        for (event = m_PendingEvents; event; event = event->sourceNext) {
+            if (event->inttime <= t && (!first || *event < *first)) {
+                first = event;
+            }
+        }
 
-        if (event->inttime > t) {
+        if (!first) {
             break;
         }
 
-        if (obj != this) {
-            // traverse normally
-            event = event->next;
-        } else {
-            // the event is removed from its list and temporarily added to the active list
-            LL_Remove(event, next, prev);
-
-            // ProcessEvent will dispose of this event when it is done
-            obj->ProcessEvent(event->event);
+        L_RemoveEvent(first);
 
-            // free up the node
-            delete event;
+        // ProcessEvent will dispose of this event when it is done
+        ProcessEvent(first->event);
 
-            // start over, since can't guarantee that we didn't process any previous or following events
-            event = Event::EventQueue.next;
+        // free up the node
+        delete first;
 
-            processedEvents = true;
-        }
+        processedEvents = true;
     }
 
     Listener::ProcessingEvents = false;
@@ -27,6 +27,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../corepp/class.h"
 #include "containerclass.h"
 #include "con_arrayset.h"
+#include "con_heap.h"
 #include "../corepp/str.h"
 #include "../corepp/vector.h"
 
@@ -103,6 +104,13 @@ class EventQueueNode;
 #define EV_PRIORITY_SPAWNACTOR -3.0f
 #define EV_SPAWNACTOR          -2.0f
 
+// Number of arguments stored inside the event before allocating an array
+#define EVENT_INLINE_ARGS          4
+#define EVENT_INLINE_VARIABLE_SIZE 16
+
+// Size of the blocks used by the frame arena of transient events
+#define EVENT_FRAME_BLOCK_SIZE 0x10000
+
 // Posted Event Flags
 #define EVENT_LEGS_ANIM   (1 << 0) // this event is associated with an animation for the legs
 #define EVENT_TORSO_ANIM  (1 << 1) // this event is associated with an animation for the torso
@@ -312,12 +320,37 @@ public:
     const char *name;
 #endif
 
+protected:
+    // large argument lists are allocated from the frame arena, see TransientEvent
+    bool transient;
+
 private:
     static DataNode *DataNodeList;
 
+    // storage for small argument lists, see EVENT_INLINE_ARGS
+    alignas(8) unsigned char inlineData[EVENT_INLINE_ARGS * EVENT_INLINE_VARIABLE_SIZE];
+
+    ScriptVariable *InlineData(void);
+    ScriptVariable *NewData(int numArgs);
+    void            DeleteData(ScriptVariable *oldData, int numArgs);
+
+protected:
+    void AllocData(int numArgs);
+    void GrowData(int numArgs);
+    void MoveData(Event& ev);
+    void FreeData(void);
+
 public:
     CLASS_PROTOTYPE(Event);
 
+    // argument lists stored inline / allocated from the frame arena / allocated on the heap
+    static size_t numInlineData;
+    static size_t numFrameData;
+    static size_t numHeapData;
+
+    // argument lists currently allocated from the frame arena
+    static size_t numLiveFrameData;
+
     static con_map<Event *, EventDef>         eventDefList;
     static con_arrayset<command_t, command_t> commandList;
 
@@ -328,13 +361,14 @@ public:
 
     static void LoadEvents(void);
 
-    static EventQueueNode EventQueue;
+    static con_heap<EventQueueNode> EventQueue;
 
     static int NumEventCommands();
 
     static void ListCommands(const char *mask = NULL);
     static void ListDocumentation(const char *mask, qboolean print_to_file = qfalse);
     static void PendingEvents(const char *mask = NULL);
+    static void DataStats(bool reset = false);
 
     static int GetEvent(str name, uchar type = EV_NORMAL);
     static int GetEventWithFlags(str name, int flags, uchar type = EV_NORMAL);
@@ -461,6 +495,19 @@ public:
     int NumArgs() const;
 };
 
+//
+// Event that is processed immediately and never outlives the frame it was created in.
+// Argument lists that don't fit in the event are allocated from the frame arena
+// instead of the heap, the arena is reset by L_ResetFrameEvents.
+//
+class TransientEvent : public Event
+{
+public:
+    TransientEvent(int index);
+    TransientEvent(int index, int numArgs);
+    TransientEvent(const Event& ev);
+};
+
 #define NODE_CANCEL      1
 #define NODE_FIXED_EVENT 2
 
@@ -472,8 +519,13 @@ public:
     int               flags;
     SafePtr<Listener> m_sourceobject;
 
-    EventQueueNode *prev;
-    EventQueueNode *next;
+    // Dispatch order between nodes that share the same inttime
+    long long sequence;
+    int       heapIndex;
+
+    // Pending events of the source object
+    EventQueueNode *sourcePrev;
+    EventQueueNode *sourceNext;
 
 #ifdef _DEBUG
     const char *name;
@@ -481,8 +533,10 @@ public:
 
     EventQueueNode()
     {
-        prev = this;
-        next = this;
+        sequence   = 0;
+        heapIndex  = 0;
+        sourcePrev = NULL;
+        sourceNext = NULL;
 
 #ifdef _DEBUG
         name = NULL;
@@ -492,6 +546,11 @@ public:
     Listener *GetSourceObject(void) { return m_sourceobject; }
 
     void SetSourceObject(Listener *obj) { m_sourceobject = obj; }
+
+    bool operator<(const EventQueueNode& other) const
+    {
+        return inttime < other.inttime || (inttime == other.inttime && sequence < other.sequence);
+    }
 };
 
 template<class Type1, class Type2>
@@ -512,6 +571,9 @@ public:
     ScriptVariableList          *vars;
 #endif
 
+    // Events posted to this listener that are still in the queue
+    EventQueueNode *m_PendingEvents;
+
     static bool EventSystemStarted;
     static bool ProcessingEvents;
 
@@ -737,3 +799,5 @@ void L_ProcessPendingEvents();
 void L_ShutdownEvents(void);
 void L_ArchiveEvents(Archiver& arc);
 void L_UnarchiveEvents(Archiver& arc);
+void L_LinkUnarchivedEvents(void);
+void L_ResetFrameEvents(void);
@@ -52,6 +52,7 @@ public:
 
 public:
     tempBlock_t *prev;
+    size_t       size;
 };
 
 MEM_TempAlloc::MEM_TempAlloc()
@@ -62,6 +63,14 @@ MEM_TempAlloc::MEM_TempAlloc()
     m_LastPos            = 0;
 }
 
+MEM_TempAlloc::MEM_TempAlloc(size_t blockSize)
+{
+    m_CurrentMemoryBlock = nullptr;
+    m_CurrentMemoryPos   = 0;
+    m_BlockSize          = blockSize;
+    m_LastPos            = 0;
+}
+
 void *MEM_TempAlloc::Alloc(size_t len)
 {
     if (m_CurrentMemoryBlock && m_CurrentMemoryPos + len <= m_BlockSize) {
@@ -101,6 +110,32 @@ void MEM_TempAlloc::FreeAll(void)
     }
 }
 
+void MEM_TempAlloc::Reset(void)
+{
+    tempBlock_t *block = m_CurrentMemoryBlock;
+    size_t       used  = m_CurrentMemoryPos;
+
+    if (!block) {
+        return;
+    }
+
+    while (block->prev) {
+        tempBlock_t *prev_block = block->prev;
+        MEM_TempFree(block);
+        block = prev_block;
+        used  = block->size;
+    }
+
+#ifdef _DEBUG
+    // poison the memory so that anything still pointing to it is noticed
+    memset(block->GetData(), 0xDD, used);
+#endif
+
+    m_CurrentMemoryBlock = block;
+    m_CurrentMemoryPos   = 0;
+    m_LastPos            = 0;
+}
+
 void *MEM_TempAlloc::CreateBlock(size_t len)
 {
     m_CurrentMemoryPos = len;
@@ -109,6 +144,7 @@ void *MEM_TempAlloc::CreateBlock(size_t len)
     tempBlock_t *prev_block    = m_CurrentMemoryBlock;
     m_CurrentMemoryBlock       = (tempBlock_t *)MEM_TempAllocate(sizeof(tempBlock_t) + Q_max(m_BlockSize, len));
     m_CurrentMemoryBlock->prev = prev_block;
+    m_CurrentMemoryBlock->size = Q_max(m_BlockSize, len);
     return m_CurrentMemoryBlock->GetData();
 }
 
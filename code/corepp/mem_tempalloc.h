@@ -32,10 +32,13 @@ class MEM_TempAlloc
 {
 public:
     MEM_TempAlloc();
+    MEM_TempAlloc(size_t blockSize);
 
     void *Alloc(size_t len);
     void *Alloc(size_t len, size_t alignment);
     void  FreeAll(void);
+    // Frees everything but the first block, which is reused for the next allocations
+    void  Reset(void);
     // This was added to fix issues with alignment
     void *CreateBlock(size_t len);
 
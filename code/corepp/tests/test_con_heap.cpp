@@ -0,0 +1,255 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks that the heap dispatches events in the same order as the sorted linked list
+// previously used by the event system, and measures post/fire time for 100k events.
+// The order check posts fewer events, as each post walks the linked list.
+//
+
+#include "../con_heap.h"
+#include "../Linklist.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+// Debug builds define Z_Malloc as a macro that forwards to Z_MallocDebug
+#ifdef ZONE_DEBUG
+void *Z_MallocDebug(int size, const char *label, const char *file, int line)
+{
+    return calloc(1, size);
+}
+#else
+void *Z_Malloc(int size)
+{
+    return calloc(1, size);
+}
+#endif
+
+void Z_Free(void *ptr)
+{
+    free(ptr);
+}
+
+static const int NUM_ORDER_EVENTS = 5000;
+static const int NUM_BENCH_EVENTS = 100000;
+
+class TestNode
+{
+public:
+    int       id;
+    int       inttime;
+    long long sequence;
+    int       heapIndex;
+
+    TestNode *prev;
+    TestNode *next;
+
+    TestNode()
+    {
+        id        = 0;
+        inttime   = 0;
+        sequence  = 0;
+        heapIndex = 0;
+        prev      = this;
+        next      = this;
+    }
+
+    bool operator<(const TestNode& other) const
+    {
+        return inttime < other.inttime || (inttime == other.inttime && sequence < other.sequence);
+    }
+};
+
+static TestNode            listRoot;
+static con_heap<TestNode>  heap;
+static long long           frontSequence;
+static long long           backSequence;
+static TestNode           *listNodes;
+static TestNode           *heapNodes;
+
+// Same insertion as the former Listener::PostEventInternal
+static void ListPost(TestNode *node)
+{
+    TestNode *i = listRoot.next;
+
+    while (i != &listRoot && node->inttime > i->inttime) {
+        i = i->next;
+    }
+
+    LL_Add(i, node, next, prev);
+}
+
+// Same insertion as the former Listener::PostponeEvent
+static void ListPostpone(TestNode *node, int delay)
+{
+    TestNode *i;
+
+    node->inttime += delay;
+
+    i = node->next;
+    while (i != &listRoot && node->inttime >= i->inttime) {
+        i = i->next;
+    }
+
+    LL_Remove(node, next, prev);
+    LL_Add(i, node, next, prev);
+}
+
+static void HeapPost(TestNode *node)
+{
+    node->sequence = --frontSequence;
+    heap.Add(node);
+}
+
+static void HeapPostpone(TestNode *node, int delay)
+{
+    node->inttime += delay;
+    node->sequence = ++backSequence;
+    heap.Update(node);
+}
+
+bool test_dispatch_order()
+{
+    int i;
+    int time;
+    int numFired;
+
+    listNodes = new TestNode[NUM_ORDER_EVENTS];
+    heapNodes = new TestNode[NUM_ORDER_EVENTS];
+
+    srand(1);
+
+    time = 0;
+    for (i = 0; i < NUM_ORDER_EVENTS; i++) {
+        // lots of events sharing the same time, like think events
+        int inttime = time + (rand() % 8) * 50;
+
+        listNodes[i].id      = i;
+        listNodes[i].inttime = inttime;
+        heapNodes[i].id      = i;
+        heapNodes[i].inttime = inttime;
+
+        ListPost(&listNodes[i]);
+        HeapPost(&heapNodes[i]);
+
+        if (i && !(i % 7)) {
+            int n     = rand() % i;
+            int delay = (rand() % 4) * 50;
+
+            if (listNodes[n].next != &listNodes[n]) {
+                ListPostpone(&listNodes[n], delay);
+                HeapPostpone(&heapNodes[n], delay);
+            }
+        }
+
+        if (i && !(i % 13)) {
+            int n = rand() % i;
+
+            if (listNodes[n].next != &listNodes[n]) {
+                LL_Remove((&listNodes[n]), next, prev);
+                heap.Remove(&heapNodes[n]);
+            }
+        }
+
+        if (!(i % 50)) {
+            time += 50;
+        }
+    }
+
+    numFired = 0;
+    while (!LL_Empty(&listRoot, next, prev)) {
+        TestNode *expected = listRoot.next;
+        TestNode *node     = heap.Pop();
+
+        LL_Remove(expected, next, prev);
+
+        if (!node || node->id != expected->id) {
+            std::cerr << "Event " << numFired << " dispatched out of order" << std::endl;
+            return false;
+        }
+
+        numFired++;
+    }
+
+    if (heap.NumObjects()) {
+        std::cerr << "Heap has " << heap.NumObjects() << " remaining events" << std::endl;
+        return false;
+    }
+
+    std::cout << "Dispatched " << numFired << " events in the expected order" << std::endl;
+
+    delete[] listNodes;
+    delete[] heapNodes;
+
+    return true;
+}
+
+bool test_benchmark()
+{
+    TestNode *nodes;
+    int       i;
+    int       time;
+
+    nodes = new TestNode[NUM_BENCH_EVENTS];
+
+    srand(2);
+
+    auto start = std::chrono::steady_clock::now();
+
+    time = 0;
+    for (i = 0; i < NUM_BENCH_EVENTS; i++) {
+        nodes[i].inttime = time + (rand() % 20) * 50;
+        HeapPost(&nodes[i]);
+    }
+
+    while (heap.NumObjects()) {
+        time += 50;
+
+        while (heap.Top() && heap.Top()->inttime <= time) {
+            heap.Pop();
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Posted and fired " << NUM_BENCH_EVENTS << " events in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us" << std::endl;
+
+    delete[] nodes;
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (!test_dispatch_order()) {
+        return 1;
+    }
+
+    if (!test_benchmark()) {
+        return 1;
+    }
+
+    return 0;
+}
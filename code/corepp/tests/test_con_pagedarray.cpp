@@ -0,0 +1,301 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Builds response tables for a class tree shaped like the game one, both as flat arrays
+// like ClassDef::BuildResponseList used to and as paged arrays sharing pages with the
+// superclass, checks that they match, and compares memory usage and dispatch time.
+//
+
+#include "../con_pagedarray.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+static const int NUM_CLASSES  = 300;
+static const int NUM_EVENTS   = 2000;
+static const int NUM_LOOKUPS  = 2000000;
+static const int NUM_ROUNDS   = 5;
+static const int MAX_RESPONSE = 64;
+
+struct TestResponse {
+    int event;
+    int handler;
+};
+
+struct TestClass {
+    int           super;
+    TestResponse  responses[MAX_RESPONSE];
+    int           numResponses;
+    TestResponse **flat;
+
+    con_pagedarray<TestResponse *> paged;
+};
+
+static TestClass *classes;
+static int       *lookupClasses;
+static int       *lookupEvents;
+
+static void MakeClasses(void)
+{
+    int nextEvent;
+    int i, j;
+
+    classes   = new TestClass[NUM_CLASSES];
+    nextEvent = 1;
+
+    srand(1);
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        TestClass *c = &classes[i];
+        int        numOwn;
+
+        // a few deep chains like Entity -> Animate -> Sentient -> Actor, and many leaves
+        c->super        = i ? rand() % (i < 20 ? i : 20 + rand() % (i - 19)) : -1;
+        c->numResponses = 0;
+        c->flat         = NULL;
+
+        // events are declared next to the class that handles them, so they get consecutive numbers
+        numOwn = rand() % 12;
+        for (j = 0; j < numOwn && nextEvent < NUM_EVENTS; j++) {
+            c->responses[c->numResponses].event   = nextEvent++;
+            c->responses[c->numResponses].handler = i;
+            c->numResponses++;
+        }
+
+        // and some events of the superclasses are overridden or disabled
+        if (i && nextEvent > 1) {
+            int numOverrides = rand() % 6;
+
+            for (j = 0; j < numOverrides; j++) {
+                c->responses[c->numResponses].event   = 1 + rand() % (nextEvent - 1);
+                c->responses[c->numResponses].handler = (rand() % 8) ? i : -1;
+                c->numResponses++;
+            }
+        }
+    }
+}
+
+static bool IsDerived(int classIndex, int super)
+{
+    for (; classIndex >= 0; classIndex = classes[classIndex].super) {
+        if (classIndex == super) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Same as the former ClassDef::BuildResponseList
+static void BuildFlat(TestClass *c)
+{
+    bool *set;
+    int   index;
+    int   i;
+
+    c->flat = new TestResponse *[NUM_EVENTS]();
+    set     = new bool[NUM_EVENTS]();
+
+    for (index = c - classes; index >= 0; index = classes[index].super) {
+        TestClass *super = &classes[index];
+
+        for (i = 0; i < super->numResponses; i++) {
+            TestResponse *r = &super->responses[i];
+
+            if (!set[r->event]) {
+                set[r->event] = true;
+                c->flat[r->event] = r->handler >= 0 ? r : NULL;
+            }
+        }
+    }
+
+    delete[] set;
+}
+
+// Same as ClassDef::BuildResponseList
+static void BuildPaged(TestClass *c)
+{
+    TestClass *super = c->super >= 0 ? &classes[c->super] : NULL;
+    int        i;
+
+    if (super && super->paged.IsEmpty()) {
+        BuildPaged(super);
+    }
+
+    c->paged.Init(NUM_EVENTS, super ? &super->paged : NULL);
+
+    for (i = c->numResponses - 1; i >= 0; i--) {
+        TestResponse *r        = &c->responses[i];
+        TestResponse *response = r->handler >= 0 ? r : NULL;
+
+        if (c->paged[r->event] != response) {
+            c->paged.Set(r->event, response);
+        }
+    }
+}
+
+static void MakeLookups(void)
+{
+    int i;
+
+    lookupClasses = new int[NUM_LOOKUPS];
+    lookupEvents  = new int[NUM_LOOKUPS];
+
+    srand(2);
+
+    // events are mostly sent to objects that handle them
+    for (i = 0; i < NUM_LOOKUPS; i++) {
+        int index = rand() % NUM_CLASSES;
+        int owner = index;
+
+        while (classes[owner].super >= 0 && (rand() % 3)) {
+            owner = classes[owner].super;
+        }
+
+        lookupClasses[i] = index;
+        if (classes[owner].numResponses && (rand() % 8)) {
+            lookupEvents[i] = classes[owner].responses[rand() % classes[owner].numResponses].event;
+        } else {
+            lookupEvents[i] = 1 + rand() % (NUM_EVENTS - 1);
+        }
+    }
+}
+
+bool test_tables()
+{
+    long long flatMemory  = 0;
+    long long pagedMemory = 0;
+    int       numChecked  = 0;
+    int       i, j;
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        BuildFlat(&classes[i]);
+    }
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        if (classes[i].paged.IsEmpty()) {
+            BuildPaged(&classes[i]);
+        }
+    }
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        for (j = 0; j < NUM_EVENTS; j++) {
+            if (classes[i].flat[j] != classes[i].paged[j]) {
+                std::cerr << "Response of event " << j << " for class " << i << " differs" << std::endl;
+                return false;
+            }
+
+            if (classes[i].flat[j] && !IsDerived(i, classes[i].flat[j]->handler)) {
+                std::cerr << "Event " << j << " of class " << i << " is handled by an unrelated class" << std::endl;
+                return false;
+            }
+
+            numChecked++;
+        }
+
+        flatMemory += NUM_EVENTS * sizeof(TestResponse *);
+        pagedMemory += classes[i].paged.MemoryUsage();
+    }
+
+    std::cout << "Checked " << numChecked << " responses, flat tables use " << flatMemory / 1024
+              << " KB, paged tables use " << pagedMemory / 1024 << " KB" << std::endl;
+
+    return true;
+}
+
+template<typename Func>
+static long long Measure(Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+bool test_benchmark()
+{
+    long long flatTime  = 0;
+    long long pagedTime = 0;
+    long long sum       = 0;
+    int       round;
+
+    // the best round is kept to reduce noise
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        long long time;
+
+        time = Measure([&] {
+            for (int i = 0; i < NUM_LOOKUPS; i++) {
+                TestResponse *r = classes[lookupClasses[i]].flat[lookupEvents[i]];
+                sum += r ? r->handler : 0;
+            }
+        });
+        if (!flatTime || time < flatTime) {
+            flatTime = time;
+        }
+
+        time = Measure([&] {
+            for (int i = 0; i < NUM_LOOKUPS; i++) {
+                TestResponse *r = classes[lookupClasses[i]].paged[lookupEvents[i]];
+                sum += r ? r->handler : 0;
+            }
+        });
+        if (!pagedTime || time < pagedTime) {
+            pagedTime = time;
+        }
+    }
+
+    std::cout << NUM_LOOKUPS << " lookups, best of " << NUM_ROUNDS << " rounds (checksum " << sum << ")" << std::endl;
+    std::cout << "flat   " << (double)flatTime / NUM_LOOKUPS << " ns per lookup" << std::endl;
+    std::cout << "paged  " << (double)pagedTime / NUM_LOOKUPS << " ns per lookup" << std::endl;
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    MakeClasses();
+    MakeLookups();
+
+    if (!test_tables()) {
+        return 1;
+    }
+
+    if (!test_benchmark()) {
+        return 1;
+    }
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        delete[] classes[i].flat;
+    }
+
+    delete[] classes;
+    delete[] lookupClasses;
+    delete[] lookupEvents;
+
+    return 0;
+}
@@ -0,0 +1,444 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks con_set / con_map against the chained hash table previously used by con_set,
+// and compares insert/lookup/erase times of both.
+//
+
+#include "../con_set.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+// Debug builds define Z_Malloc as a macro that forwards to Z_MallocDebug
+#ifdef ZONE_DEBUG
+void *Z_MallocDebug(int size, const char *label, const char *file, int line)
+{
+    return calloc(1, size);
+}
+#else
+void *Z_Malloc(int size)
+{
+    return calloc(1, size);
+}
+#endif
+
+void Z_Free(void *ptr)
+{
+    free(ptr);
+}
+
+template<>
+int HashCode<int>(const int& key)
+{
+    return key;
+}
+
+static const int NUM_KEYS   = 100000;
+static const int NUM_ROUNDS = 10;
+
+//
+// The former con_set: chained buckets, entries allocated from a block allocator
+//
+class ChainedEntry
+{
+public:
+    ChainedEntry *next;
+    int           key;
+    int           value;
+
+    static MEM_BlockAlloc<ChainedEntry> allocator;
+
+    void *operator new(size_t size) { return allocator.Alloc(); }
+
+    void operator delete(void *ptr) { allocator.Free(ptr); }
+};
+
+MEM_BlockAlloc<ChainedEntry> ChainedEntry::allocator;
+
+class ChainedSet
+{
+private:
+    ChainedEntry **table;
+    ChainedEntry  *defaultEntry;
+    unsigned int   tableLength;
+    unsigned int   threshold;
+    unsigned int   count;
+
+    void resize(void)
+    {
+        ChainedEntry **oldTable       = table;
+        unsigned int   oldTableLength = tableLength;
+        ChainedEntry  *e, *old;
+        unsigned int   i;
+
+        threshold = (unsigned int)((float)tableLength * 0.75);
+        if (threshold < 1) {
+            threshold = 1;
+        }
+
+        tableLength += threshold;
+        table = new ChainedEntry *[tableLength]();
+
+        for (i = oldTableLength; i > 0; i--) {
+            for (e = oldTable[i - 1]; e != NULL; e = old) {
+                unsigned int index = HashCode<int>(e->key) % tableLength;
+
+                old          = e->next;
+                e->next      = table[index];
+                table[index] = e;
+            }
+        }
+
+        if (oldTableLength > 1) {
+            delete[] oldTable;
+        }
+    }
+
+public:
+    ChainedSet()
+    {
+        table        = &defaultEntry;
+        defaultEntry = NULL;
+        tableLength  = 1;
+        threshold    = 1;
+        count        = 0;
+    }
+
+    ~ChainedSet()
+    {
+        ChainedEntry *e, *next;
+        unsigned int  i;
+
+        for (i = 0; i < tableLength; i++) {
+            for (e = table[i]; e != NULL; e = next) {
+                next = e->next;
+                delete e;
+            }
+        }
+
+        if (tableLength > 1) {
+            delete[] table;
+        }
+    }
+
+    int *find(int key)
+    {
+        ChainedEntry *e;
+
+        for (e = table[HashCode<int>(key) % tableLength]; e != NULL; e = e->next) {
+            if (e->key == key) {
+                return &e->value;
+            }
+        }
+
+        return NULL;
+    }
+
+    int& add(int key)
+    {
+        ChainedEntry *e = find(key) ? NULL : new ChainedEntry;
+        unsigned int  index;
+
+        if (!e) {
+            return *find(key);
+        }
+
+        if (count >= threshold) {
+            resize();
+        }
+
+        count++;
+
+        e->key   = key;
+        e->value = 0;
+        index    = HashCode<int>(key) % tableLength;
+
+        if (defaultEntry == NULL) {
+            defaultEntry = e;
+            e->next      = NULL;
+        } else {
+            e->next = table[index];
+        }
+        table[index] = e;
+
+        return e->value;
+    }
+
+    bool remove(int key)
+    {
+        unsigned int  index = HashCode<int>(key) % tableLength;
+        ChainedEntry *prev  = NULL;
+        ChainedEntry *e;
+
+        for (e = table[index]; e != NULL; prev = e, e = e->next) {
+            if (e->key != key) {
+                continue;
+            }
+
+            if (prev) {
+                prev->next = e->next;
+            } else {
+                table[index] = e->next;
+            }
+
+            if (defaultEntry == e) {
+                defaultEntry = NULL;
+            }
+
+            count--;
+            delete e;
+            return true;
+        }
+
+        return false;
+    }
+};
+
+static int *keys;
+static int *lookups;
+
+static void MakeKeys(void)
+{
+    int i;
+
+    keys    = new int[NUM_KEYS];
+    lookups = new int[NUM_KEYS * 2];
+
+    srand(1);
+    for (i = 0; i < NUM_KEYS; i++) {
+        // const_str and pointer keys are mostly clustered values
+        keys[i] = (i * 4) + (rand() % 4);
+    }
+
+    // keys are inserted, looked up and removed in no particular order
+    for (i = NUM_KEYS - 1; i > 0; i--) {
+        int n   = rand() % (i + 1);
+        int key = keys[i];
+
+        keys[i] = keys[n];
+        keys[n] = key;
+    }
+
+    // about half of the lookups are for missing keys
+    for (i = 0; i < NUM_KEYS * 2; i++) {
+        lookups[i] = rand() % (NUM_KEYS * 4);
+    }
+}
+
+bool test_consistency()
+{
+    con_map<int, int> map;
+    ChainedSet        reference;
+    int              *stable;
+    int               i;
+
+    srand(2);
+
+    stable  = &map[-1];
+    *stable = 1234;
+
+    for (i = 0; i < NUM_KEYS * 4; i++) {
+        int  key = rand() % (NUM_KEYS / 2);
+        int *found;
+
+        switch (rand() % 3) {
+        case 0:
+            map[key]       = i;
+            reference.add(key) = i;
+            break;
+        case 1:
+            if (map.remove(key) != reference.remove(key)) {
+                std::cerr << "Removal of key " << key << " differs" << std::endl;
+                return false;
+            }
+            break;
+        default:
+            found = map.find(key);
+            if ((found != NULL) != (reference.find(key) != NULL) || (found && *found != *reference.find(key))) {
+                std::cerr << "Lookup of key " << key << " differs" << std::endl;
+                return false;
+            }
+            break;
+        }
+    }
+
+    // values must not move when the table grows
+    if (map.find(-1) != stable || *stable != 1234) {
+        std::cerr << "Value moved after rehashing" << std::endl;
+        return false;
+    }
+
+    std::cout << "Random operations match the chained table" << std::endl;
+
+    return true;
+}
+
+bool test_enumerate_remove()
+{
+    con_set<int, int>           set;
+    con_set_enum<int, int>      en;
+    con_set<int, int>::Entry   *entry;
+    int                         i;
+    int                         visited;
+
+    for (i = 0; i < NUM_KEYS; i++) {
+        set.addKeyValue(keys[i]) = i;
+    }
+
+    // removing the current element while enumerating must visit every element once
+    en      = set;
+    visited = 0;
+    for (entry = en.NextElement(); entry; entry = en.NextElement()) {
+        visited++;
+        set.remove(entry->GetKey());
+    }
+
+    if (visited != NUM_KEYS || set.size()) {
+        std::cerr << "Visited " << visited << " elements, " << set.size() << " remaining" << std::endl;
+        return false;
+    }
+
+    std::cout << "Enumerated and removed " << visited << " elements" << std::endl;
+
+    return true;
+}
+
+template<typename Func>
+static long long Measure(Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+static void Report(const char *name, long long times[4])
+{
+    std::cout << name << "  insert " << times[0] / NUM_KEYS << " ns, lookup " << times[1] / (NUM_KEYS * 2)
+              << " ns, dependent lookup " << times[2] / NUM_KEYS << " ns, erase " << times[3] / NUM_KEYS << " ns"
+              << std::endl;
+}
+
+static void KeepBest(long long& best, long long time)
+{
+    if (!best || time < best) {
+        best = time;
+    }
+}
+
+bool test_benchmark()
+{
+    long long chainedTimes[4] = {0, 0, 0, 0};
+    long long setTimes[4]     = {0, 0, 0, 0};
+    long long sum             = 0;
+    int       round;
+
+    // the best round is kept to reduce noise
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        ChainedSet       *chained = new ChainedSet;
+        con_map<int, int> map;
+
+        KeepBest(chainedTimes[0], Measure([&] {
+            for (int i = 0; i < NUM_KEYS; i++) {
+                chained->add(keys[i]) = i;
+            }
+        }));
+        KeepBest(chainedTimes[1], Measure([&] {
+            for (int i = 0; i < NUM_KEYS * 2; i++) {
+                int *value = chained->find(lookups[i]);
+                sum += value ? *value : 0;
+            }
+        }));
+        // each key depends on the previous value, like most lookups done by scripts
+        KeepBest(chainedTimes[2], Measure([&] {
+            int value = 0;
+            for (int i = 0; i < NUM_KEYS; i++) {
+                value = *chained->find(keys[(value + i) % NUM_KEYS]);
+            }
+            sum += value;
+        }));
+        KeepBest(chainedTimes[3], Measure([&] {
+            for (int i = 0; i < NUM_KEYS; i++) {
+                chained->remove(keys[i]);
+            }
+        }));
+
+        KeepBest(setTimes[0], Measure([&] {
+            for (int i = 0; i < NUM_KEYS; i++) {
+                map[keys[i]] = i;
+            }
+        }));
+        KeepBest(setTimes[1], Measure([&] {
+            for (int i = 0; i < NUM_KEYS * 2; i++) {
+                int *value = map.find(lookups[i]);
+                sum += value ? *value : 0;
+            }
+        }));
+        KeepBest(setTimes[2], Measure([&] {
+            int value = 0;
+            for (int i = 0; i < NUM_KEYS; i++) {
+                value = *map.find(keys[(value + i) % NUM_KEYS]);
+            }
+            sum += value;
+        }));
+        KeepBest(setTimes[3], Measure([&] {
+            for (int i = 0; i < NUM_KEYS; i++) {
+                map.remove(keys[i]);
+            }
+        }));
+
+        delete chained;
+    }
+
+    std::cout << NUM_KEYS << " keys, best of " << NUM_ROUNDS << " rounds (checksum " << sum << ")" << std::endl;
+    Report("chained", chainedTimes);
+    Report("con_set", setTimes);
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    MakeKeys();
+
+    if (!test_consistency()) {
+        return 1;
+    }
+
+    if (!test_enumerate_remove()) {
+        return 1;
+    }
+
+    if (!test_benchmark()) {
+        return 1;
+    }
+
+    delete[] keys;
+    delete[] lookups;
+
+    return 0;
+}
@@ -0,0 +1,253 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks that con_strpool gives the same indexes as the con_arrayset<str, str> previously
+// used for the script strings, and compares the lookup times of both.
+//
+
+#include "../con_strpool.h"
+#include "../con_arrayset.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+
+// Debug builds define Z_Malloc as a macro that forwards to Z_MallocDebug
+#ifdef ZONE_DEBUG
+void *Z_MallocDebug(int size, const char *label, const char *file, int line)
+{
+    return calloc(1, size);
+}
+#else
+void *Z_Malloc(int size)
+{
+    return calloc(1, size);
+}
+#endif
+
+void Z_Free(void *ptr)
+{
+    free(ptr);
+}
+
+static const int NUM_STRINGS = 20000;
+static const int NUM_ROUNDS  = 50;
+
+// Separate copies of the strings, like the names read from scripts and entity keys
+static char **names;
+
+#define CHECK(condition)                                                     \
+    if (!(condition)) {                                                      \
+        std::cerr << __FUNCTION__ << ": failed " << #condition << std::endl; \
+        return false;                                                        \
+    }
+
+void MakeNames()
+{
+    static const char *prefixes[] = {"targetname_", "anim/", "global/", "thread_", "ai_"};
+    char               buffer[64];
+    int                i;
+
+    names = new char *[NUM_STRINGS];
+
+    for (i = 0; i < NUM_STRINGS; i++) {
+        snprintf(buffer, sizeof(buffer), "%s%d", prefixes[i % 5], i * 7919 % 100003);
+        names[i] = new char[strlen(buffer) + 1];
+        strcpy(names[i], buffer);
+    }
+}
+
+bool test_consistency()
+{
+    con_strpool            pool;
+    con_arrayset<str, str> reference;
+    char                   buffer[64];
+    int                    i;
+
+    for (i = 0; i < NUM_STRINGS; i++) {
+        CHECK(pool.addKeyIndex(names[i]) == reference.addKeyIndex(names[i]));
+    }
+
+    CHECK(pool.size() == reference.size());
+
+    for (i = 0; i < NUM_STRINGS; i++) {
+        const unsigned int index = reference.findKeyIndex(names[i]);
+
+        // from another buffer, from the string of the pool, and from a str
+        strcpy(buffer, names[i]);
+        CHECK(pool.findKeyIndex(buffer) == index);
+        CHECK(pool.findKeyIndex(pool[index].c_str()) == index);
+        CHECK(pool.findKeyIndex(str(names[i])) == index);
+        CHECK(pool[index] == reference[index]);
+
+        // adding the string again keeps its index
+        CHECK(pool.addKeyIndex(str(buffer)) == index);
+    }
+
+    // the same buffer holding other strings
+    strcpy(buffer, names[0]);
+    CHECK(pool.findKeyIndex(buffer) == 1);
+    strcpy(buffer, names[1]);
+    CHECK(pool.findKeyIndex(buffer) == 2);
+    strcpy(buffer, "not in the pool");
+    CHECK(pool.findKeyIndex(buffer) == 0);
+    CHECK(pool.findKeyIndex("") == 0);
+    CHECK(pool.size() == NUM_STRINGS);
+
+    // strings are case sensitive
+    CHECK(pool.findKeyIndex("TARGETNAME_0") == 0);
+
+    pool.clear();
+    CHECK(pool.size() == 0);
+    CHECK(pool.findKeyIndex(names[0]) == 0);
+    CHECK(pool.addKeyIndex(names[1]) == 1);
+    CHECK(pool.addKeyIndex("") == 2);
+    CHECK(pool.findKeyIndex("") == 2);
+    CHECK(pool[1] == names[1]);
+
+    return true;
+}
+
+bool test_references()
+{
+    con_strpool pool;
+    str        *first;
+    int         i;
+
+    pool.addKeyIndex("first");
+    first = &pool[1];
+
+    // growing the pool doesn't move the strings
+    for (i = 0; i < NUM_STRINGS; i++) {
+        pool.addKeyIndex(names[i]);
+    }
+
+    CHECK(first == &pool[1]);
+    CHECK(*first == "first");
+
+    return true;
+}
+
+bool test_benchmark()
+{
+    con_strpool            pool;
+    con_arrayset<str, str> reference;
+    const char           **interned;
+    unsigned int           sum;
+    int                    i, j;
+
+    for (i = 0; i < NUM_STRINGS; i++) {
+        pool.addKeyIndex(names[i]);
+        reference.addKeyIndex(names[i]);
+    }
+
+    interned = new const char *[NUM_STRINGS];
+    for (i = 0; i < NUM_STRINGS; i++) {
+        interned[i] = pool[i + 1].c_str();
+    }
+
+    //
+    // The former lookup built a str from the C string
+    //
+    sum        = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (j = 0; j < NUM_ROUNDS; j++) {
+        for (i = 0; i < NUM_STRINGS; i++) {
+            sum += reference.findKeyIndex(names[i]);
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "con_arrayset lookups: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+              << " us (" << sum << ")" << std::endl;
+
+    sum   = 0;
+    start = std::chrono::steady_clock::now();
+
+    for (j = 0; j < NUM_ROUNDS; j++) {
+        for (i = 0; i < NUM_STRINGS; i++) {
+            sum += pool.findKeyIndex(names[i]);
+        }
+    }
+
+    end = std::chrono::steady_clock::now();
+
+    std::cout << "con_strpool lookups: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+              << " us (" << sum << ")" << std::endl;
+
+    //
+    // Lookups of the same few names, like the commands of a script running every frame
+    //
+    pool.ResetStats();
+
+    sum   = 0;
+    start = std::chrono::steady_clock::now();
+
+    for (j = 0; j < NUM_ROUNDS * 100; j++) {
+        for (i = 0; i < 100; i++) {
+            sum += pool.findKeyIndex(interned[i]);
+        }
+    }
+
+    end = std::chrono::steady_clock::now();
+
+    std::cout << "con_strpool lookups of interned strings: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us (" << sum << ", "
+              << pool.NumRecentHits() * 100 / pool.NumLookups() << "% found from the pointer)" << std::endl;
+
+    std::cout << "con_strpool memory: " << pool.MemoryUsage() << " bytes for " << pool.size() << " strings"
+              << std::endl;
+
+    delete[] interned;
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    MakeNames();
+
+    if (!test_consistency()) {
+        return 1;
+    }
+
+    if (!test_references()) {
+        return 1;
+    }
+
+    if (!test_benchmark()) {
+        return 1;
+    }
+
+    for (i = 0; i < NUM_STRINGS; i++) {
+        delete[] names[i];
+    }
+    delete[] names;
+
+    return 0;
+}
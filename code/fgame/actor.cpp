@@ -47,6 +47,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "parm.h"
 #include "../corepp/tiki.h"
 #include "smokesprite.h"
+#include "ailod.h"
 
 #include <cmath>
 
@@ -4031,7 +4032,7 @@ bool Actor::CanSeeFrom(vec3_t pos, Entity *ent)
         return false;
     }
 
-    return G_SightTrace(pos, vec_zero, vec_zero, ent->centroid, this, ent, MASK_CANSEE, false, "Actor::CanSeeFrom");
+    return G_CachedSightTrace(pos, ent->centroid, this, ent, MASK_CANSEE, "Actor::CanSeeFrom");
 }
 
 /*
@@ -7528,6 +7529,11 @@ void Actor::Think(void)
         return;
     }
 
+    if (!aiLod.ShouldThink(this, !IsIdleThink())) {
+        // keeps playing the current animation
+        return;
+    }
+
     m_bAnimating = false;
 
     Director.Pause();
@@ -7580,9 +7586,31 @@ void Actor::Think(void)
     m_bNeedReload        = false;
     mbBreakSpecialAttack = false;
 
+    aiLod.EndThink();
+
     Director.Unpause();
 }
 
+/*
+===============
+Actor::IsIdleThink
+
+Whether the actor is idle and standing, its think can be delayed.
+===============
+*/
+bool Actor::IsIdleThink(void) const
+{
+    if (m_Enemy || m_bDirtyThinkState) {
+        return false;
+    }
+
+    if (m_ThinkState != THINKSTATE_IDLE || CurrentThink() != THINK_IDLE) {
+        return false;
+    }
+
+    return !PathExists();
+}
+
 /*
 ===============
 Actor::CheckUnregister
@@ -1421,6 +1421,7 @@ public:
     void           EndCurrentThinkState(void);
     void           ClearThinkStates(void);
     int            CurrentThink(void) const;
+    bool           IsIdleThink(void) const;
     bool           IsAttacking(void) const;
     void           EventGetFov(Event *ev);
     void           EventSetFov(Event *ev);
@@ -0,0 +1,212 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+
+// ailod.cpp: Think rate of the AI, by relevance to the clients.
+
+#include "ailod.h"
+#include "entity.h"
+#include "game.h"
+#include "level.h"
+#include "player.h"
+
+AILod aiLod;
+
+static const char *tierNames[NUM_AI_LODS] = {"full", "far", "hidden"};
+
+AILod::AILod()
+{
+    Clear();
+}
+
+/*
+====================
+Clear
+
+Resets the tiers and the statistics, must be called when the edicts are reset
+====================
+*/
+void AILod::Clear()
+{
+    memset(tiers, 0, sizeof(tiers));
+    memset(stats, 0, sizeof(stats));
+
+    numViews  = 0;
+    viewFrame = -1;
+    thinkTier = -1;
+}
+
+/*
+====================
+UpdateViews
+
+Gathers the eyes of the human clients, once per frame
+====================
+*/
+void AILod::UpdateViews()
+{
+    gentity_t *ed;
+    int        i;
+
+    if (viewFrame == level.framenum) {
+        return;
+    }
+
+    viewFrame = level.framenum;
+    numViews  = 0;
+
+    for (i = 0; i < game.maxclients; i++) {
+        ed = &g_entities[i];
+
+        if (!ed->inuse || !ed->client || !ed->entity || (ed->r.svFlags & SVF_BOT)) {
+            continue;
+        }
+
+        if (!ed->entity->IsSubclassOfPlayer()) {
+            continue;
+        }
+
+        viewOrigins[numViews++] = static_cast<Player *>(ed->entity)->EyePosition();
+    }
+}
+
+/*
+====================
+ComputeTier
+
+Nearest tier over the human clients
+====================
+*/
+int AILod::ComputeTier(Entity *ent)
+{
+    float distance;
+    bool  visible;
+    int   i;
+
+    UpdateViews();
+
+    distance = g_ai_lod_distance->value;
+    visible  = false;
+
+    for (i = 0; i < numViews; i++) {
+        if ((viewOrigins[i] - ent->centroid).lengthSquared() <= Square(distance)) {
+            return AI_LOD_FULL;
+        }
+
+        if (!visible && gi.InPVS(viewOrigins[i], ent->centroid)) {
+            visible = true;
+        }
+    }
+
+    return visible ? AI_LOD_FAR : AI_LOD_HIDDEN;
+}
+
+int AILod::Interval(int tier)
+{
+    switch (tier) {
+    case AI_LOD_FAR:
+        return Q_max(g_ai_lod_far_frames->integer, 1);
+    case AI_LOD_HIDDEN:
+        return Q_max(g_ai_lod_hidden_frames->integer, 1);
+    default:
+        return 1;
+    }
+}
+
+/*
+====================
+ShouldThink
+
+Returns whether the entity thinks this frame. When it does,
+the think is timed until EndThink.
+mustThink is set by the caller when the entity can't wait, like in combat.
+====================
+*/
+bool AILod::ShouldThink(Entity *ent, bool mustThink)
+{
+    int tier;
+
+    if (!g_ai_lod->integer) {
+        return true;
+    }
+
+    if (mustThink) {
+        tier = AI_LOD_FULL;
+        // computed again at the first think out of combat
+        tiers[ent->entnum] = AI_LOD_FULL;
+    } else {
+        tier = tiers[ent->entnum];
+
+        if ((level.framenum + ent->entnum) % Interval(tier)) {
+            stats[tier].numSkipped++;
+            return false;
+        }
+
+        tiers[ent->entnum] = ComputeTier(ent);
+    }
+
+    stats[tier].numThinks++;
+
+    // started last so the tier isn't timed
+    thinkTier  = tier;
+    thinkStart = qcclock_t::now();
+
+    return true;
+}
+
+void AILod::EndThink()
+{
+    if (thinkTier == -1) {
+        return;
+    }
+
+    stats[thinkTier].thinkTime +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(qcclock_t::now() - thinkStart).count();
+
+    thinkTier = -1;
+}
+
+void AILod::PrintStats(bool reset)
+{
+    int i;
+
+    if (!g_ai_lod->integer) {
+        gi.Printf("g_ai_lod is not set\n");
+    }
+
+    gi.Printf("tier       thinks    skipped    time ms  us/think\n");
+
+    for (i = 0; i < NUM_AI_LODS; i++) {
+        gi.Printf(
+            "%-6s %10d %10d %10.3f %9.2f\n",
+            tierNames[i],
+            stats[i].numThinks,
+            stats[i].numSkipped,
+            stats[i].thinkTime / 1000000.0,
+            stats[i].numThinks ? stats[i].thinkTime / 1000.0 / stats[i].numThinks : 0.0
+        );
+    }
+
+    if (reset) {
+        memset(stats, 0, sizeof(stats));
+    }
+}
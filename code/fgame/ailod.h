@@ -0,0 +1,81 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+
+// ailod.h: Think rate of the AI, by relevance to the clients.
+//
+// While g_ai_lod is set, actors and bots that nothing depends on think less often:
+// those farther than g_ai_lod_distance from every client think once every g_ai_lod_far_frames,
+// those outside the PVS of every client once every g_ai_lod_hidden_frames.
+// Entities think on the frames where (framenum + entnum) is a multiple of their interval,
+// so the skipped thinks are spread over the frames. The tier of an entity is computed
+// when it thinks; an entity in combat, moving or changing state thinks every frame.
+//
+// Bots aren't clients for this purpose: only human clients make the AI relevant.
+
+#pragma once
+
+#include "g_local.h"
+#include "../corepp/vector.h"
+
+#define AI_LOD_FULL   0 // thinks every frame
+#define AI_LOD_FAR    1 // in the PVS of a client, but far from all of them
+#define AI_LOD_HIDDEN 2 // outside the PVS of all clients
+#define NUM_AI_LODS   3
+
+typedef struct {
+    int       numThinks;
+    int       numSkipped;
+    long long thinkTime; // nanoseconds
+} aiLodStats_t;
+
+class AILod
+{
+private:
+    int          tiers[MAX_GENTITIES]; // tier computed at the last think of each entity
+    aiLodStats_t stats[NUM_AI_LODS];
+
+    Vector viewOrigins[MAX_CLIENTS]; // eyes of the human clients
+    int    numViews;
+    int    viewFrame; // frame of viewOrigins, -1 if they must be gathered
+
+    int      thinkTier; // -1 if no think is being timed
+    qctime_t thinkStart;
+
+private:
+    void UpdateViews();
+    int  ComputeTier(Entity *ent);
+
+    static int Interval(int tier);
+
+public:
+    AILod();
+
+    void Clear();
+
+    bool ShouldThink(Entity *ent, bool mustThink);
+    void EndThink();
+
+    void PrintStats(bool reset);
+};
+
+extern AILod aiLod;
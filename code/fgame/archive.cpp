@@ -438,7 +438,9 @@ qboolean Archiver::Read(const char *name, qboolean harderror)
     }
 
     ArchiveString(&info);
-    gi.DPrintf("%s\n", info.c_str());
+    if (!silent) {
+        gi.DPrintf("%s\n", info.c_str());
+    }
 
     // setup out class pointers
     ArchiveInteger(&num);
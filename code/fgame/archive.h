@@ -282,53 +282,54 @@ void Container<Type>::Archive(Archiver& arc)
 template<typename key, typename value>
 void con_set<key, value>::Archive(Archiver& arc)
 {
-    Entry *e = NULL;
-    int    hash;
-    int    i;
+    Entry             *e = NULL;
+    unsigned int       length;
+    unsigned int       oldThreshold;
+    unsigned int       num;
+    unsigned int       index;
+    unsigned int       i;
+    short unsigned int lengthIndex;
+
+    //
+    // The header is the one of the former chained hash table,
+    // the table itself is rebuilt when loading
+    //
+    if (arc.Loading()) {
+        clear();
 
-    arc.ArchiveUnsigned(&tableLength);
-    arc.ArchiveUnsigned(&threshold);
-    arc.ArchiveUnsigned(&count);
-    arc.ArchiveUnsignedShort(&tableLengthIndex);
+        arc.ArchiveUnsigned(&length);
+        arc.ArchiveUnsigned(&oldThreshold);
+        arc.ArchiveUnsigned(&num);
+        arc.ArchiveUnsignedShort(&lengthIndex);
 
-    if (arc.Loading()) {
-        if (tableLength != 1) {
-            table = new (NewTable(tableLength)) Entry *[tableLength]();
-            memset(table, 0, tableLength * sizeof(Entry *));
+        if (num) {
+            resize(num);
         }
 
-        for (i = 0; i < count; i++) {
-            e = new Entry;
+        for (i = 0; i < num; i++) {
+            index = NewEntryIndex();
+            e     = EntryAt(index);
             e->Archive(arc);
 
-            hash = HashCode<key>(e->GetKey()) % tableLength;
-
-            e->next     = table[hash];
-            table[hash] = e;
+            insertEntry(HashKey(e->GetKey()), index);
+            count++;
         }
-
-        defaultEntry = e;
     } else {
-#    ifndef NDEBUG
-        int total;
+        length       = tableLength ? tableLength : 1;
+        oldThreshold = threshold;
+        num          = count;
+        lengthIndex  = tableLengthIndex;
 
-        total = 0;
+        arc.ArchiveUnsigned(&length);
+        arc.ArchiveUnsigned(&oldThreshold);
+        arc.ArchiveUnsigned(&num);
+        arc.ArchiveUnsignedShort(&lengthIndex);
 
         for (i = 0; i < tableLength; i++) {
-            for (e = table[i]; e != NULL; e = e->next) {
-                e->Archive(arc);
-                total++;
-            }
-        }
-        // it must match the number of elements
-        assert(total == count);
-#    else
-        for (i = 0; i < tableLength; i++) {
-            for (e = table[i]; e != NULL; e = e->next) {
-                e->Archive(arc);
+            if (table[i].index) {
+                EntryAt(table[i].index)->Archive(arc);
             }
         }
-#    endif
     }
 }
 
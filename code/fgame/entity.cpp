@@ -57,6 +57,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "g_spawn.h"
 #include "g_phys.h"
 #include "debuglines.h"
+#include "entitygrid.h"
 #include "../corepp/tiki.h"
 #include <utility>
 
@@ -2260,11 +2261,17 @@ Vector Entity::getLocalVector(Vector vec)
 void Entity::link(void)
 {
     gi.linkentity(edict);
+
+    // doors and other brush models block the sight
+    G_UpdateSightBlocker(edict, absmin, absmax);
+
     absmin   = edict->r.absmin;
     absmax   = edict->r.absmax;
     centroid = (absmin + absmax) * 0.5;
     centroid.copyTo(edict->r.centroid);
 
+    entityGrid.Link(edict);
+
     // If this has a parent, then set the areanum the same
     // as the parent's
     if (edict->s.parent != ENTITYNUM_NONE) {
@@ -2894,7 +2901,7 @@ bool Entity::CanSee(Entity *ent, float fov, float vision_distance, bool bNoEnts)
         mask = MASK_CANSEE;
     }
 
-    return G_SightTrace(centroid, vec_zero, vec_zero, ent->centroid, this, ent, mask, qfalse, "Sentient::CanSee");
+    return G_CachedSightTrace(centroid, ent->centroid, this, ent, mask, "Sentient::CanSee");
 }
 
 bool Entity::CanSee(const Vector& org, float fov, float vision_distance, bool bNoEnts)
@@ -2918,7 +2925,7 @@ bool Entity::CanSee(const Vector& org, float fov, float vision_distance, bool bN
         mask = MASK_CANSEE;
     }
 
-    return G_SightTrace(centroid, vec_zero, vec_zero, org, this, NULL, mask, qfalse, "Sentient::CanSee");
+    return G_CachedSightTrace(centroid, org, this, NULL, mask, "Sentient::CanSee");
 }
 
 void Entity::FadeNoRemove(Event *ev)
@@ -0,0 +1,439 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// entitygrid.cpp: Spatial index of the entities, for the radius queries.
+
+#include "entitygrid.h"
+#include "entity.h"
+
+EntityGrid entityGrid;
+
+EntityGrid::EntityGrid()
+{
+    Clear();
+}
+
+/*
+====================
+CellForCoord
+
+Clamped to GRID_MAX_CELL, so the cell ranges of the largest queries fit in an int
+====================
+*/
+inline int EntityGrid::CellForCoord(float coord)
+{
+    const double cell = floor((double)coord / GRID_CELL_SIZE);
+
+    if (cell < -GRID_MAX_CELL) {
+        return -GRID_MAX_CELL;
+    } else if (cell > GRID_MAX_CELL) {
+        return GRID_MAX_CELL;
+    }
+
+    return (int)cell;
+}
+
+inline int EntityGrid::BucketForCell(int cellX, int cellY)
+{
+    return ((unsigned int)cellX * 73856093u ^ (unsigned int)cellY * 19349663u) & (GRID_NUM_BUCKETS - 1);
+}
+
+void EntityGrid::Insert(int entnum, int bucket)
+{
+    entityGridNode_t *node = &nodes[entnum];
+
+    node->bucket = bucket;
+    node->prev   = -1;
+    node->next   = buckets[bucket];
+
+    if (node->next != -1) {
+        nodes[node->next].prev = entnum;
+    }
+
+    buckets[bucket] = entnum;
+
+    if (bucket == GRID_LARGE) {
+        numLarge++;
+    }
+}
+
+void EntityGrid::Remove(int entnum)
+{
+    entityGridNode_t *node = &nodes[entnum];
+
+    if (node->prev != -1) {
+        nodes[node->prev].next = node->next;
+    } else {
+        buckets[node->bucket] = node->next;
+    }
+
+    if (node->next != -1) {
+        nodes[node->next].prev = node->prev;
+    }
+
+    if (node->bucket == GRID_LARGE) {
+        numLarge--;
+    }
+
+    node->bucket = -1;
+}
+
+/*
+====================
+Clear
+
+Removes all entities, must be called when the edicts are reset
+====================
+*/
+void EntityGrid::Clear()
+{
+    int i;
+
+    for (i = 0; i < MAX_GENTITIES; i++) {
+        nodes[i].bucket = -1;
+    }
+
+    for (i = 0; i <= GRID_NUM_BUCKETS; i++) {
+        buckets[i] = -1;
+    }
+
+    numLarge = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+/*
+====================
+Link
+
+Moves the entity to the cell of its centroid
+====================
+*/
+void EntityGrid::Link(gentity_t *ed)
+{
+    entityGridNode_t *node;
+    int               entnum;
+    int               cellX, cellY;
+    int               bucket;
+
+    entnum = ed->s.number;
+    if (entnum < 0 || entnum >= MAX_GENTITIES) {
+        return;
+    }
+
+    node = &nodes[entnum];
+
+    if (ed->r.radius > GRID_MAX_RADIUS || ed->r.absmax[0] - ed->r.absmin[0] > GRID_MAX_RADIUS * 2
+        || ed->r.absmax[1] - ed->r.absmin[1] > GRID_MAX_RADIUS * 2) {
+        // the bounds of rotated entities can reach farther than their radius
+        if (node->bucket == GRID_LARGE) {
+            return;
+        }
+
+        cellX  = 0;
+        cellY  = 0;
+        bucket = GRID_LARGE;
+    } else {
+        cellX = CellForCoord(ed->r.centroid[0]);
+        cellY = CellForCoord(ed->r.centroid[1]);
+
+        // most entities move within their cell
+        if (node->bucket != -1 && node->bucket != GRID_LARGE && node->cellX == cellX && node->cellY == cellY) {
+            return;
+        }
+
+        bucket = BucketForCell(cellX, cellY);
+    }
+
+    if (node->bucket != -1) {
+        Remove(entnum);
+    }
+
+    node->cellX = cellX;
+    node->cellY = cellY;
+    Insert(entnum, bucket);
+}
+
+void EntityGrid::Unlink(gentity_t *ed)
+{
+    const int entnum = ed->s.number;
+
+    if (entnum < 0 || entnum >= MAX_GENTITIES || nodes[entnum].bucket == -1) {
+        return;
+    }
+
+    Remove(entnum);
+}
+
+/*
+====================
+InRadius
+
+Same test as findradius: the distance to the centroid, less the radius of the entity,
+is within the radius of the query
+====================
+*/
+bool EntityGrid::InRadius(gentity_t *ed, const Vector& org, float r2)
+{
+    Vector delta;
+    float  distance;
+
+    delta    = org - ed->entity->centroid;
+    distance = delta * delta;
+
+    return distance <= r2 || distance - ed->radius2 <= r2;
+}
+
+/*
+====================
+InBox
+
+Same test as gi.AreaEntities, on the bounds of the linked entities
+====================
+*/
+bool EntityGrid::InBox(gentity_t *ed, const Vector& mins, const Vector& maxs)
+{
+    if (!ed->r.linked) {
+        return false;
+    }
+
+    return ed->r.absmin[0] <= maxs[0] && ed->r.absmin[1] <= maxs[1] && ed->r.absmin[2] <= maxs[2]
+        && ed->r.absmax[0] >= mins[0] && ed->r.absmax[1] >= mins[1] && ed->r.absmax[2] >= mins[2];
+}
+
+static bool RadiusTest(gentity_t *ed, const void *parm)
+{
+    const entityGridRadius_t *radius = (const entityGridRadius_t *)parm;
+
+    return EntityGrid::InRadius(ed, radius->org, radius->r2);
+}
+
+static bool BoxTest(gentity_t *ed, const void *parm)
+{
+    const entityGridBox_t *box = (const entityGridBox_t *)parm;
+
+    return EntityGrid::InBox(ed, box->mins, box->maxs);
+}
+
+/*
+====================
+Find
+
+Fills entityList with the numbers of the entities in the cells minX to maxX and minY to maxY,
+and of the large entities, that pass the test. Entities are listed in increasing order.
+Returns the number of entities.
+====================
+*/
+int EntityGrid::Find(
+    int minX, int minY, int maxX, int maxY, entityGridTest_t test, const void *parm, int *entityList, int maxCount
+)
+{
+    unsigned int      found[MAX_GENTITIES / 32];
+    entityGridNode_t *node;
+    gentity_t        *ed;
+    int               cellX, cellY;
+    long long         numCells;
+    int               count;
+    int               i, j;
+
+    memset(found, 0, sizeof(found));
+
+    stats.numQueries++;
+
+    numCells = (long long)(maxX - minX + 1) * (maxY - minY + 1);
+
+    if (numCells > GRID_NUM_BUCKETS) {
+        // the cells would visit the buckets more than once
+        for (i = 0; i < GRID_NUM_BUCKETS; i++) {
+            for (j = buckets[i]; j != -1; j = node->next) {
+                node = &nodes[j];
+
+                if (node->cellX < minX || node->cellX > maxX || node->cellY < minY || node->cellY > maxY) {
+                    continue;
+                }
+
+                stats.numCandidates++;
+
+                ed = &g_entities[j];
+                if (ed->inuse && ed->entity && test(ed, parm)) {
+                    found[j >> 5] |= 1u << (j & 31);
+                }
+            }
+        }
+
+        stats.numCells += GRID_NUM_BUCKETS;
+    } else {
+        for (cellY = minY; cellY <= maxY; cellY++) {
+            for (cellX = minX; cellX <= maxX; cellX++) {
+                for (j = buckets[BucketForCell(cellX, cellY)]; j != -1; j = node->next) {
+                    node = &nodes[j];
+
+                    // other cells share the bucket
+                    if (node->cellX != cellX || node->cellY != cellY) {
+                        continue;
+                    }
+
+                    stats.numCandidates++;
+
+                    ed = &g_entities[j];
+                    if (ed->inuse && ed->entity && test(ed, parm)) {
+                        found[j >> 5] |= 1u << (j & 31);
+                    }
+                }
+            }
+        }
+
+        stats.numCells += (int)numCells;
+    }
+
+    for (j = buckets[GRID_LARGE]; j != -1; j = nodes[j].next) {
+        stats.numCandidates++;
+
+        ed = &g_entities[j];
+        if (ed->inuse && ed->entity && test(ed, parm)) {
+            found[j >> 5] |= 1u << (j & 31);
+        }
+    }
+
+    count = 0;
+
+    for (i = 0; i < MAX_GENTITIES / 32; i++) {
+        if (!found[i]) {
+            continue;
+        }
+
+        for (j = 0; j < 32 && count < maxCount; j++) {
+            if (found[i] & (1u << j)) {
+                entityList[count++] = (i << 5) + j;
+            }
+        }
+    }
+
+    stats.numFound += count;
+
+    return count;
+}
+
+/*
+====================
+FindInRadius
+
+Fills entityList with the numbers of the entities in the radius, in increasing order.
+Returns the number of entities.
+====================
+*/
+int EntityGrid::FindInRadius(const Vector& org, float radius, int *entityList, int maxCount)
+{
+    entityGridRadius_t parm;
+
+    parm.org = org;
+    parm.r2  = radius * radius;
+
+    return Find(
+        CellForCoord(org[0] - radius - GRID_MAX_RADIUS),
+        CellForCoord(org[1] - radius - GRID_MAX_RADIUS),
+        CellForCoord(org[0] + radius + GRID_MAX_RADIUS),
+        CellForCoord(org[1] + radius + GRID_MAX_RADIUS),
+        RadiusTest,
+        &parm,
+        entityList,
+        maxCount
+    );
+}
+
+/*
+====================
+FindInBox
+
+Fills entityList with the numbers of the linked entities whose bounds touch mins and maxs,
+in increasing order. Returns the number of entities.
+====================
+*/
+int EntityGrid::FindInBox(const Vector& mins, const Vector& maxs, int *entityList, int maxCount)
+{
+    entityGridBox_t parm;
+
+    parm.mins = mins;
+    parm.maxs = maxs;
+
+    return Find(
+        CellForCoord(mins[0] - GRID_MAX_RADIUS),
+        CellForCoord(mins[1] - GRID_MAX_RADIUS),
+        CellForCoord(maxs[0] + GRID_MAX_RADIUS),
+        CellForCoord(maxs[1] + GRID_MAX_RADIUS),
+        BoxTest,
+        &parm,
+        entityList,
+        maxCount
+    );
+}
+
+/*
+====================
+QueryCost
+
+Number of cells and large entities a query of this radius checks,
+for the callers choosing between the grid and a shorter list
+====================
+*/
+int EntityGrid::QueryCost(float radius) const
+{
+    double side;
+
+    side = ceil(((double)radius + GRID_MAX_RADIUS) * 2 / GRID_CELL_SIZE) + 1;
+
+    if (side * side > GRID_NUM_BUCKETS) {
+        return GRID_NUM_BUCKETS + numLarge;
+    }
+
+    return (int)(side * side) + numLarge;
+}
+
+void EntityGrid::PrintStats(bool reset)
+{
+    int numEntities;
+    int i;
+
+    numEntities = 0;
+    for (i = 0; i < MAX_GENTITIES; i++) {
+        if (nodes[i].bucket != -1) {
+            numEntities++;
+        }
+    }
+
+    gi.Printf("%d entities in the grid, %d of them large\n", numEntities, numLarge);
+    gi.Printf("%d queries", stats.numQueries);
+
+    if (stats.numQueries) {
+        gi.Printf(
+            ", %.1f cells, %.1f candidates and %.1f entities found per query",
+            (float)stats.numCells / stats.numQueries,
+            (float)stats.numCandidates / stats.numQueries,
+            (float)stats.numFound / stats.numQueries
+        );
+    }
+
+    gi.Printf("\n");
+
+    if (reset) {
+        memset(&stats, 0, sizeof(stats));
+    }
+}
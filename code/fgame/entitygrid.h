@@ -0,0 +1,107 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// entitygrid.h: Spatial index of the entities, for the radius queries.
+//
+// Each entity is kept in the cell of a 2D grid holding the x and y of its centroid,
+// updated every time the entity is linked. The cells are hashed into a fixed number of buckets,
+// so the grid doesn't depend on the size of the map. Queries visit the cells overlapping
+// the radius or the box extended by GRID_MAX_RADIUS; entities with a larger radius or
+// larger bounds are kept in a separate list checked by every query.
+//
+// Like findradius, unlinked entities stay in the grid until their edict is freed.
+
+#pragma once
+
+#include "g_local.h"
+#include "../corepp/vector.h"
+
+#define GRID_CELL_SIZE   256
+#define GRID_MAX_RADIUS  256 // entities with a larger radius aren't kept in the cells
+#define GRID_NUM_BUCKETS 1024
+#define GRID_LARGE       GRID_NUM_BUCKETS // bucket of the large entities
+#define GRID_MAX_CELL    (1 << 20)        // cells are clamped to this range on both axes
+
+typedef struct {
+    int next;
+    int prev;
+    int bucket; // -1 if the entity isn't in the grid
+    int cellX;
+    int cellY;
+} entityGridNode_t;
+
+typedef struct {
+    Vector org;
+    float  r2;
+} entityGridRadius_t;
+
+typedef struct {
+    Vector mins;
+    Vector maxs;
+} entityGridBox_t;
+
+typedef bool (*entityGridTest_t)(gentity_t *ed, const void *parm);
+
+typedef struct {
+    int numQueries;
+    int numCells;
+    int numCandidates;
+    int numFound;
+} entityGridStats_t;
+
+class EntityGrid
+{
+private:
+    entityGridNode_t  nodes[MAX_GENTITIES];
+    int               buckets[GRID_NUM_BUCKETS + 1]; // first entity of each bucket, -1 if empty
+    int               numLarge;
+    entityGridStats_t stats;
+
+private:
+    static int CellForCoord(float coord);
+    static int BucketForCell(int cellX, int cellY);
+
+    void Insert(int entnum, int bucket);
+    void Remove(int entnum);
+
+    int Find(
+        int minX, int minY, int maxX, int maxY, entityGridTest_t test, const void *parm, int *entityList, int maxCount
+    );
+
+public:
+    EntityGrid();
+
+    void Clear();
+    void Link(gentity_t *ed);
+    void Unlink(gentity_t *ed);
+
+    int FindInRadius(const Vector& org, float radius, int *entityList, int maxCount);
+    int FindInBox(const Vector& mins, const Vector& maxs, int *entityList, int maxCount);
+    int QueryCost(float radius) const;
+
+    static bool InRadius(gentity_t *ed, const Vector& org, float r2);
+    static bool InBox(gentity_t *ed, const Vector& mins, const Vector& maxs);
+
+    void PrintStats(bool reset);
+};
+
+extern EntityGrid entityGrid;
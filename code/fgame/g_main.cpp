@@ -39,6 +39,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "playerbot.h"
 #include "g_bot.h"
 #include "navigation_recast_load.h"
+#include "entitygrid.h"
+#include "ailod.h"
 
 #include "../corepp/tiki.h"
 
@@ -46,7 +48,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #    include <intrin.h>
 #endif
 
-#define SAVEGAME_VERSION   80
+#define SAVEGAME_VERSION   81
 #define PERSISTANT_VERSION 2
 
 static char G_ErrorMessage[4096];
@@ -208,6 +210,9 @@ void G_AllocGameData(void)
         LL_Add(&free_edicts, &g_entities[i], next, prev);
     }
 
+    entityGrid.Clear();
+    aiLod.Clear();
+
     // initialize all clients for this game
     game.clients = (gclient_t *)gi.Malloc(game.maxclients * sizeof(game.clients[0]));
     memset(game.clients, 0, game.maxclients * sizeof(game.clients[0]));
@@ -398,6 +403,35 @@ void G_Precache(void)
     level.Precache();
 }
 
+/*
+================
+G_QueueRotationScripts
+
+Queue the scripts of the maps in the rotation for precompilation
+================
+*/
+static void G_QueueRotationScripts(void)
+{
+    static const char *seps = " ,\n\r";
+    char              *s, *t;
+
+    if (!g_precompilescripts->integer) {
+        return;
+    }
+
+    if (sv_nextmap->string && sv_nextmap->string[0]) {
+        Director.QueuePrecompileMap(sv_nextmap->string);
+    }
+
+    if (sv_maplist->string && sv_maplist->string[0]) {
+        s = strdup(sv_maplist->string);
+        for (t = strtok(s, seps); t; t = strtok(NULL, seps)) {
+            Director.QueuePrecompileMap(t);
+        }
+        free(s);
+    }
+}
+
 /*
 ================
 G_Precache
@@ -411,6 +445,8 @@ void G_ServerSpawned(void)
         G_BotPostInit();
 
         level.ServerSpawned();
+
+        G_QueueRotationScripts();
     } catch (const ScriptException& e) {
         G_ExitWithError(e.string.c_str());
     }
@@ -485,6 +521,9 @@ void G_RunFrame(int levelTime, int frameTime)
     try {
         g_iInThinks = 0;
 
+        // events dispatched since the last frame are done with their arguments
+        L_ResetFrameEvents();
+
         if (g_showmem->integer) {
             DisplayMemoryUsage();
         }
@@ -738,6 +777,9 @@ void G_RunFrame(int levelTime, int frameTime)
             // Add or delete bots that were added using addbot/removebot
             G_SpawnBots();
         }
+
+        // compile the scripts of the next maps outside of script execution
+        Director.PrecompileScripts(g_precompilescripts->integer);
     }
 
     catch (const char *error) {
@@ -1568,6 +1610,8 @@ qboolean G_ArchiveLevel(
 
         if (arc.Loading()) {
             arc.Close();
+            // Pending events can be attached to their listener now that pointers are resolved
+            L_LinkUnarchivedEvents();
             LoadingSavegame = false;
             gi.Printf(HUD_MESSAGE_YELLOW "%s\n", gi.LV_ConvertString("Game Loaded"));
         } else {
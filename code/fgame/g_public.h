@@ -503,6 +503,11 @@ typedef struct gameImport_s {
 
     cvar_t *fsDebug;
 
+    /**
+     * Replace a file of the home directory by another one
+     */
+    qboolean (*FS_Rename)(const char *from, const char *to);
+
 } game_import_t;
 
 typedef struct gameExport_s {
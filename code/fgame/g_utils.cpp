@@ -31,6 +31,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "playerstart.h"
 #include "debuglines.h"
 #include "smokesprite.h"
+#include "entitygrid.h"
 #include "../corepp/tiki.h"
 
 const char *means_of_death_strings[MOD_TOTAL_NUMBER] = {
@@ -93,6 +94,8 @@ qboolean MOD_matches(int incoming_damage, int damage_type)
 ============
 G_TouchTriggers
 
+Checks the triggers around ent against its bounds, the same test gi.AreaEntities does
+for the linked entities, with the entity grid instead of the world sectors
 ============
 */
 void G_TouchTriggers(Entity *ent)
@@ -101,19 +104,19 @@ void G_TouchTriggers(Entity *ent)
     int        num;
     int        touch[MAX_GENTITIES];
     gentity_t *hit;
-    Event     *ev;
 
     // dead things don't activate triggers!
     if ((ent->client || (ent->edict->r.svFlags & SVF_MONSTER)) && (ent->IsDead())) {
         return;
     }
 
-    num = gi.AreaEntities(ent->absmin, ent->absmax, touch, MAX_GENTITIES);
+    num = entityGrid.FindInBox(ent->absmin, ent->absmax, touch, MAX_GENTITIES);
 
-    // be careful, it is possible to have an entity in this
-    // list removed before we get to it (killtriggered)
     for (i = 0; i < num; i++) {
         hit = &g_entities[touch[i]];
+
+        // be careful, it is possible to have an entity in this
+        // list removed before we get to it (killtriggered)
         if (!hit->inuse || (hit->entity == ent) || (hit->solid != SOLID_TRIGGER)) {
             continue;
         }
@@ -126,8 +129,8 @@ void G_TouchTriggers(Entity *ent)
 
         assert(hit->entity);
 
-        ev = new Event(EV_Touch);
-        ev->AddEntity(ent);
+        Event ev(EV_Touch, 1);
+        ev.AddEntity(ent);
         hit->entity->ProcessEvent(ev);
     }
 }
@@ -146,7 +149,6 @@ void G_TouchSolids(Entity *ent)
     int        num;
     int        touch[MAX_GENTITIES];
     gentity_t *hit;
-    Event     *ev;
 
     num = gi.AreaEntities(ent->absmin, ent->absmax, touch, MAX_GENTITIES);
 
@@ -162,8 +164,8 @@ void G_TouchSolids(Entity *ent)
 
         //FIXME
         // should we post the events so that we don't have to worry about any entities going away
-        ev = new Event(EV_Touch);
-        ev->AddEntity(ent);
+        Event ev(EV_Touch, 1);
+        ev.AddEntity(ent);
         hit->entity->ProcessEvent(ev);
     }
 }
@@ -346,6 +348,207 @@ bool G_SightTrace(
     return result == true;
 }
 
+#define SIGHT_CACHE_BITS 12
+#define SIGHT_CACHE_SIZE (1 << SIGHT_CACHE_BITS)
+#define SIGHT_KEY_LENGTH 9
+
+typedef struct {
+    int   key[SIGHT_KEY_LENGTH]; // both points rounded to units, both entity numbers and the mask
+    int   generation;
+    float value; // visibility of the sight traces, obfuscation of G_VisualObfuscation
+} sightCacheEntry_t;
+
+typedef struct {
+    int numLookups;
+    int numHits;
+    int numInvalidations;
+} sightCacheStats_t;
+
+// Entries of an older generation are stale, a new generation starts each frame
+static sightCacheEntry_t sightCache[SIGHT_CACHE_SIZE];
+static int               sightCacheGeneration = 1;
+static int               sightCacheFrame      = -1;
+static sightCacheStats_t sightCacheStats;
+
+/*
+============
+G_InvalidateSightCache
+
+Must be called when something that blocks the sight moves, like doors
+============
+*/
+void G_InvalidateSightCache(void)
+{
+    sightCacheGeneration++;
+    sightCacheStats.numInvalidations++;
+}
+
+// Brush models that blocked the sight when they were last linked, by entity number
+static unsigned int sightBlockerBits[MAX_GENTITIES / 32];
+
+/*
+============
+G_UpdateSightBlocker
+
+Must be called after ed is linked or unlinked, with its bounds before.
+Invalidates the sight cache when ed starts or stops blocking the sight,
+or moves while blocking it. Bits left by freed entities only cause one
+more invalidation when their number is reused.
+============
+*/
+void G_UpdateSightBlocker(gentity_t *ed, const vec3_t oldAbsmin, const vec3_t oldAbsmax)
+{
+    const int          entnum = ed->s.number;
+    const unsigned int bit    = 1u << (entnum & 31);
+    bool               blocks;
+    bool               blocked;
+
+    blocks  = ed->r.linked && ed->r.bmodel && (ed->r.contents & MASK_CANSEE);
+    blocked = (sightBlockerBits[entnum >> 5] & bit) != 0;
+
+    if (blocks) {
+        sightBlockerBits[entnum >> 5] |= bit;
+    } else {
+        sightBlockerBits[entnum >> 5] &= ~bit;
+    }
+
+    if (blocks != blocked) {
+        G_InvalidateSightCache();
+    } else if (blocks && (!VectorCompare(oldAbsmin, ed->r.absmin) || !VectorCompare(oldAbsmax, ed->r.absmax))) {
+        G_InvalidateSightCache();
+    }
+}
+
+/*
+============
+G_FindSightCache
+
+Returns the entry for the points, found is set if it holds the value of a previous query
+in this frame. The trace between two points is the same both ways, the points are
+ordered so queries in both directions share the entry.
+============
+*/
+static sightCacheEntry_t *
+G_FindSightCache(const Vector& start, const Vector& end, int entnum, int entnum2, int mask, bool& found)
+{
+    sightCacheEntry_t *entry;
+    int                key[SIGHT_KEY_LENGTH];
+    int                swap;
+    unsigned int       hash;
+    int                i;
+
+    if (level.framenum != sightCacheFrame) {
+        sightCacheFrame = level.framenum;
+        sightCacheGeneration++;
+    }
+
+    for (i = 0; i < 3; i++) {
+        key[i]     = (int)floor(start[i] + 0.5f);
+        key[i + 3] = (int)floor(end[i] + 0.5f);
+    }
+
+    for (i = 0; i < 3 && key[i] == key[i + 3]; i++) {}
+
+    if (entnum > entnum2 || (entnum == entnum2 && i < 3 && key[i] > key[i + 3])) {
+        for (i = 0; i < 3; i++) {
+            swap       = key[i];
+            key[i]     = key[i + 3];
+            key[i + 3] = swap;
+        }
+
+        swap    = entnum;
+        entnum  = entnum2;
+        entnum2 = swap;
+    }
+
+    key[6] = entnum;
+    key[7] = entnum2;
+    key[8] = mask;
+
+    hash = 0;
+    for (i = 0; i < SIGHT_KEY_LENGTH; i++) {
+        hash = (hash + (unsigned int)key[i]) * 0x9E3779B9u;
+    }
+
+    entry = &sightCache[hash >> (32 - SIGHT_CACHE_BITS)];
+
+    sightCacheStats.numLookups++;
+
+    if (entry->generation == sightCacheGeneration && !memcmp(entry->key, key, sizeof(key))) {
+        sightCacheStats.numHits++;
+        found = true;
+        return entry;
+    }
+
+    // replaces the previous query
+    memcpy(entry->key, key, sizeof(key));
+    entry->generation = sightCacheGeneration;
+
+    found = false;
+    return entry;
+}
+
+/*
+============
+G_CachedSightTrace
+
+Line of sight between two points, traced once per frame for the same points,
+entities and mask
+============
+*/
+bool G_CachedSightTrace(
+    const Vector& start, const Vector& end, Entity *passent, Entity *passent2, int contentmask, const char *reason
+)
+{
+    sightCacheEntry_t *entry;
+    int                entnum, entnum2;
+    bool               found;
+
+    if (!g_sightcache->integer) {
+        return G_SightTrace(start, vec_zero, vec_zero, end, passent, passent2, contentmask, qfalse, reason);
+    }
+
+    if (passent == NULL || !passent->isSubclassOf(Entity)) {
+        entnum = ENTITYNUM_NONE;
+    } else {
+        entnum = passent->entnum;
+    }
+
+    if (passent2 == NULL || !passent2->isSubclassOf(Entity)) {
+        entnum2 = ENTITYNUM_NONE;
+    } else {
+        entnum2 = passent2->entnum;
+    }
+
+    entry = G_FindSightCache(start, end, entnum, entnum2, contentmask, found);
+    if (!found) {
+        entry->value = G_SightTrace(start, vec_zero, vec_zero, end, passent, passent2, contentmask, qfalse, reason)
+                         ? 1.f
+                         : 0.f;
+    }
+
+    return entry->value != 0;
+}
+
+void G_PrintSightCacheStats(bool reset)
+{
+    gi.Printf(
+        "%d sight lookups, %d found in the cache (%.1f%%), %d invalidations\n",
+        sightCacheStats.numLookups,
+        sightCacheStats.numHits,
+        sightCacheStats.numLookups ? sightCacheStats.numHits * 100.f / sightCacheStats.numLookups : 0.f,
+        sightCacheStats.numInvalidations
+    );
+
+    if (!g_sightcache->integer) {
+        gi.Printf("g_sightcache is not set\n");
+    }
+
+    if (reset) {
+        memset(&sightCacheStats, 0, sizeof(sightCacheStats));
+    }
+}
+
 void G_PMDrawTrace(
     trace_t     *results,
     const vec3_t start,
@@ -506,19 +709,34 @@ void G_TraceEntities(
 
 float G_VisualObfuscation(const Vector& start, const Vector& end)
 {
-    float alpha;
+    sightCacheEntry_t *entry;
+    float              alpha;
+    bool               found;
 
     if (start == end) {
         // no obfuscation
         return 0;
     }
 
+    entry = NULL;
+    if (g_sightcache->integer) {
+        // -1 isn't a content mask, these entries don't mix with the sight traces
+        entry = G_FindSightCache(start, end, ENTITYNUM_NONE, ENTITYNUM_NONE, -1, found);
+        if (found) {
+            return entry->value;
+        }
+    }
+
     alpha = gi.CM_VisualObfuscation(start, end);
-    if (alpha >= 1.f) {
-        return alpha;
+    if (alpha < 1.f) {
+        alpha = G_ObfuscationForSmokeSprites(alpha, start, end);
     }
 
-    return G_ObfuscationForSmokeSprites(alpha, start, end);
+    if (entry) {
+        entry->value = alpha;
+    }
+
+    return alpha;
 }
 
 /*
@@ -1014,57 +1232,81 @@ qboolean IsNumeric(const char *str)
     return true;
 }
 
+typedef struct {
+    Vector origin;
+    float  radius;
+    int    numEntities;
+    int    next; // position following the last entity returned
+    int    entities[MAX_GENTITIES];
+} radiusQuery_t;
+
 /*
 =================
-findradius
-
-Returns entities that have origins within a spherical area
+G_RadiusQueryStart
 
-findradius (org, radius)
+Returns the position of the first entity numbered after startent.
+The entities are queried from the grid when the iteration starts or when the
+origin or the radius changed, otherwise the entities of the previous query are used.
 =================
 */
-Entity *findradius(Entity *startent, Vector org, float rad)
+static int G_RadiusQueryStart(radiusQuery_t *query, Entity *startent, const Vector& org, float rad)
 {
-    Vector     eorg;
-    gentity_t *from;
-    float      r2, distance;
+    int i;
+
+    if (!startent || org != query->origin || rad != query->radius) {
+        query->origin      = org;
+        query->radius      = rad;
+        query->numEntities = entityGrid.FindInRadius(org, rad, query->entities, MAX_GENTITIES);
+        query->next        = 0;
+    }
 
     if (!startent) {
-        from = active_edicts.next;
-    } else {
-        from = startent->edict->next;
+        return 0;
     }
 
-    assert(from);
-    if (!from) {
-        return NULL;
+    if (query->next > 0 && query->next <= query->numEntities
+        && query->entities[query->next - 1] == startent->entnum) {
+        return query->next;
     }
 
-    assert((from == &active_edicts) || (from->inuse));
+    for (i = 0; i < query->numEntities && query->entities[i] <= startent->entnum; i++) {}
 
-    // square the radius so that we don't have to do a square root
-    r2 = rad * rad;
+    return i;
+}
 
-    for (; from != &active_edicts; from = from->next) {
-        assert(from->inuse);
-        assert(from->entity);
+/*
+=================
+findradius
 
-        eorg = org - from->entity->centroid;
+Returns entities that have origins within a spherical area,
+in increasing order of entity number
 
-        // dot product returns length squared
-        distance = eorg * eorg;
+findradius (org, radius)
+=================
+*/
+Entity *findradius(Entity *startent, Vector org, float rad)
+{
+    static radiusQuery_t query;
+    gentity_t           *ed;
+    float                r2;
+    int                  i;
 
-        if (distance <= r2) {
-            return from->entity;
-        } else {
-            // subtract the object's own radius from this distance
-            distance -= from->radius2;
-            if (distance <= r2) {
-                return from->entity;
-            }
+    // square the radius so that we don't have to do a square root
+    r2 = rad * rad;
+
+    for (i = G_RadiusQueryStart(&query, startent, org, rad); i < query.numEntities; i++) {
+        ed = &g_entities[query.entities[i]];
+
+        // entities of the query may have been removed or moved since
+        if (!ed->inuse || !ed->entity || !EntityGrid::InRadius(ed, org, r2)) {
+            continue;
         }
+
+        query.next = i + 1;
+        return ed->entity;
     }
 
+    query.next = query.numEntities;
     return NULL;
 }
 
@@ -1079,14 +1321,38 @@ findclientinradius (org, radius)
 */
 Entity *findclientsinradius(Entity *startent, Vector org, float rad)
 {
-    Vector     eorg;
-    gentity_t *ed;
-    float      r2;
-    int        i;
+    static radiusQuery_t query;
+    Vector               eorg;
+    gentity_t           *ed;
+    float                r2;
+    int                  i;
 
     // square the radius so that we don't have to do a square root
     r2 = rad * rad;
 
+    if (entityGrid.QueryCost(rad) < game.maxclients) {
+        for (i = G_RadiusQueryStart(&query, startent, org, rad);
+             i < query.numEntities && query.entities[i] < game.maxclients;
+             i++) {
+            ed = &g_entities[query.entities[i]];
+
+            if (!ed->inuse || !ed->entity) {
+                continue;
+            }
+
+            eorg = org - ed->entity->centroid;
+
+            // the grid also returns the clients reaching the radius with their size
+            if ((eorg * eorg) <= r2) {
+                query.next = i + 1;
+                return ed->entity;
+            }
+        }
+
+        query.next = query.numEntities;
+        return NULL;
+    }
+
     if (!startent) {
         i = 0;
     } else {
@@ -1390,6 +1656,7 @@ void G_ArchiveEdict(Archiver& arc, gentity_t *edict)
 
     if (arc.Loading()) {
         gi.linkentity(edict);
+        entityGrid.Link(edict);
     }
 
     arc.ArchiveInteger(&edict->r.lastNetTime);
@@ -1783,17 +2050,50 @@ void G_BroadcastAIEvent(Entity *originator, Vector origin, char *pszType)
     G_BroadcastAIEvent(originator, origin, G_AIEventTypeFromString(pszType), -1.0f);
 }
 
+static void G_SendAIEvent(Sentient *ent, Entity *originator, Vector origin, int iType, float r2, int iAreaNum)
+{
+    Actor *act;
+    Vector delta;
+    float  dist2;
+
+    if ((ent == originator) || ent->deadflag) {
+        return;
+    }
+
+    if (!ent->IsSubclassOfActor()) {
+        return;
+    }
+
+    act = static_cast<Actor *>(ent);
+    if (act->IgnoreSound(iType)) {
+        return;
+    }
+
+    delta = origin - ent->centroid;
+
+    // dot product returns length squared
+    dist2 = Square(delta);
+
+    if (dist2 > r2) {
+        return;
+    }
+
+    if (iAreaNum != ent->edict->r.areanum && !gi.AreasConnected(iAreaNum, ent->edict->r.areanum)) {
+        return;
+    }
+
+    act->ReceiveAIEvent(origin, iType, originator, dist2, r2);
+}
+
 void G_BroadcastAIEvent(Entity *originator, Vector origin, int iType, float radius)
 {
     Sentient *ent;
-    Actor    *act;
-    Vector    delta;
-    str       name;
     float     r2;
-    float     dist2;
     int       i;
     int       iNumSentients;
+    int       iNumEntities;
     int       iAreaNum;
+    int       entityList[MAX_GENTITIES];
 
     if (iType == AI_EVENT_MISC || iType == AI_EVENT_MISC_LOUD) {
         ent = static_cast<Sentient *>(G_GetEntity(0));
@@ -1809,43 +2109,29 @@ void G_BroadcastAIEvent(Entity *originator, Vector origin, int iType, float radi
 
     assert(originator);
 
+    if (originator) {
+        iAreaNum = originator->edict->r.areanum;
+    } else {
+        iAreaNum = gi.AreaForPoint(origin);
+    }
+
     r2            = Square(radius);
     iNumSentients = SentientList.NumObjects();
-    for (i = 1; i <= iNumSentients; i++) {
-        ent = SentientList.ObjectAt(i);
-        if ((ent == originator) || ent->deadflag) {
-            continue;
-        }
-
-        if (!ent->IsSubclassOfActor()) {
-            continue;
-        }
-
-        act = static_cast<Actor *>(ent);
-        if (act->IgnoreSound(iType)) {
-            continue;
-        }
 
-        delta = origin - ent->centroid;
+    if (entityGrid.QueryCost(radius) < iNumSentients) {
+        // the grid returns the entities reaching the radius with their size, a superset of the sentients heard
+        iNumEntities = entityGrid.FindInRadius(origin, radius, entityList, MAX_GENTITIES);
+        for (i = 0; i < iNumEntities; i++) {
+            Entity *entity = g_entities[entityList[i]].entity;
 
-        // dot product returns length squared
-        dist2 = Square(delta);
-
-        if (originator) {
-            iAreaNum = originator->edict->r.areanum;
-        } else {
-            iAreaNum = gi.AreaForPoint(origin);
-        }
-
-        if (dist2 > r2) {
-            continue;
+            if (entity->IsSubclassOfSentient()) {
+                G_SendAIEvent(static_cast<Sentient *>(entity), originator, origin, iType, r2, iAreaNum);
+            }
         }
-
-        if (iAreaNum != ent->edict->r.areanum && !gi.AreasConnected(iAreaNum, ent->edict->r.areanum)) {
-            continue;
+    } else {
+        for (i = 1; i <= iNumSentients; i++) {
+            G_SendAIEvent(SentientList.ObjectAt(i), originator, origin, iType, r2, iAreaNum);
         }
-
-        act->ReceiveAIEvent(origin, iType, originator, dist2, r2);
     }
 
     botManager.BroadcastEvent(originator, origin, iType, radius);
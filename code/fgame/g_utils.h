@@ -71,6 +71,12 @@ bool G_SightTrace(
     qboolean      cylindrical,
     const char   *reason
 );
+bool G_CachedSightTrace(
+    const Vector& start, const Vector& end, Entity *passent, Entity *passent2, int contentmask, const char *reason
+);
+void G_InvalidateSightCache(void);
+void G_UpdateSightBlocker(gentity_t *ed, const vec3_t oldAbsmin, const vec3_t oldAbsmax);
+void G_PrintSightCacheStats(bool reset);
 
 void G_PMDrawTrace(
     trace_t     *results,
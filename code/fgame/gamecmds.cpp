@@ -32,9 +32,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "lodthing.h"
 #include "player.h"
 #include <scriptcompiler.h>
+#include <scriptprofiler.h>
 #include "playerbot.h"
 #include "consoleevent.h"
 #include "g_bot.h"
+#include "entitygrid.h"
+#include "ailod.h"
 
 typedef struct {
     const char *command;
@@ -49,35 +52,46 @@ typedef struct {
 
 consolecmd_t G_ConsoleCmds[] = {
     //   command name       function             available in multiplayer?
-    {"say",             G_SayCmd,             qtrue },
-    {"eventlist",       G_EventListCmd,       qfalse},
-    {"pendingevents",   G_PendingEventsCmd,   qfalse},
-    {"eventhelp",       G_EventHelpCmd,       qfalse},
-    {"dumpevents",      G_DumpEventsCmd,      qfalse},
-    {"classevents",     G_ClassEventsCmd,     qfalse},
-    {"dumpclassevents", G_DumpClassEventsCmd, qfalse},
-    {"dumpallclasses",  G_DumpAllClassesCmd,  qtrue },
-    {"classlist",       G_ClassListCmd,       qfalse},
-    {"classtree",       G_ClassTreeCmd,       qfalse},
-    {"cam",             G_CameraCmd,          qfalse},
-    {"snd",             G_SoundCmd,           qfalse},
-    {"showvar",         G_ShowVarCmd,         qfalse},
-    {"levelvars",       G_LevelVarsCmd,       qfalse},
-    {"gamevars",        G_GameVarsCmd,        qfalse},
-    {"script",          G_ScriptCmd,          qfalse},
+    {"say",              G_SayCmd,              qtrue },
+    {"eventlist",        G_EventListCmd,        qfalse},
+    {"pendingevents",    G_PendingEventsCmd,    qfalse},
+    {"eventhelp",        G_EventHelpCmd,        qfalse},
+    {"dumpevents",       G_DumpEventsCmd,       qfalse},
+    {"classevents",      G_ClassEventsCmd,      qfalse},
+    {"dumpclassevents",  G_DumpClassEventsCmd,  qfalse},
+    {"dumpallclasses",   G_DumpAllClassesCmd,   qtrue },
+    {"classlist",        G_ClassListCmd,        qfalse},
+    {"classtree",        G_ClassTreeCmd,        qfalse},
+    {"cam",              G_CameraCmd,           qfalse},
+    {"snd",              G_SoundCmd,            qfalse},
+    {"showvar",          G_ShowVarCmd,          qfalse},
+    {"levelvars",        G_LevelVarsCmd,        qfalse},
+    {"gamevars",         G_GameVarsCmd,         qfalse},
+    {"script",           G_ScriptCmd,           qfalse},
     // Added in 2.0
-    {"reloadmap",       G_ReloadMap,          qfalse},
+    {"reloadmap",        G_ReloadMap,           qfalse},
     // Added in OPM
     //====
-    {"compilescript",   G_CompileScript,      qfalse},
-    {"addbot",          G_AddBotCommand,      qfalse},
-    {"addbotnamed",     G_AddBotNamedCommand, qfalse},
-    {"removebot",       G_RemoveBotCommand,   qfalse},
+    {"compilescript",    G_CompileScript,       qfalse},
+    {"addbot",           G_AddBotCommand,       qfalse},
+    {"addbotnamed",      G_AddBotNamedCommand,  qfalse},
+    {"removebot",        G_RemoveBotCommand,    qfalse},
+    {"eventstats",       G_EventStatsCmd,       qfalse},
+    {"scriptbench",      G_ScriptBenchCmd,      qfalse},
+    {"scriptcachestats", G_ScriptCacheStatsCmd, qfalse},
+    {"stringstats",      G_StringStatsCmd,      qfalse},
+    {"scripttimes",      G_ScriptTimesCmd,      qfalse},
+    {"scriptprofile",    G_ScriptProfileCmd,    qfalse},
+    {"gridstats",        G_GridStatsCmd,        qfalse},
+    {"radiusbench",      G_RadiusBenchCmd,      qfalse},
+    {"sightstats",       G_SightStatsCmd,       qfalse},
+    {"botbench",         G_BotBenchCmd,         qfalse},
+    {"ailodstats",       G_AILodStatsCmd,       qfalse},
 #ifdef _DEBUG
-    {"bot",             G_BotCommand,         qfalse},
+    {"bot",              G_BotCommand,          qfalse},
 #endif
     //====
-    {NULL,              NULL,                 qfalse}
+    {NULL,               NULL,                  qfalse}
 };
 
 Container<commandmaster_t> commandMasters;
@@ -454,6 +468,17 @@ qboolean G_PendingEventsCmd(gentity_t *ent)
     return qtrue;
 }
 
+qboolean G_EventStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    Event::DataStats(reset);
+
+    return qtrue;
+}
+
 qboolean G_EventHelpCmd(gentity_t *ent)
 {
     const char *mask;
@@ -629,6 +654,265 @@ qboolean G_CompileScript(gentity_t *ent)
     return qtrue;
 }
 
+qboolean G_ScriptCacheStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    CompiledScriptStats(reset);
+
+    return qtrue;
+}
+
+qboolean G_StringStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    Director.PrintStringStats(reset);
+
+    return qtrue;
+}
+
+qboolean G_ScriptTimesCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    Director.PrintThreadTimes(reset);
+
+    return qtrue;
+}
+
+qboolean G_ScriptProfileCmd(gentity_t *ent)
+{
+    str stacks;
+
+    if (gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset")) {
+        scriptProfiler.Clear();
+        return qtrue;
+    }
+
+    if (gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "dump")) {
+        if (gi.Argc() <= 2) {
+            gi.Printf("Usage: scriptprofile dump [filename]\n");
+            return qfalse;
+        }
+
+        // collapsed stacks, for flamegraph.pl
+        stacks = scriptProfiler.CollapsedStacks();
+        gi.FS_WriteFile(gi.Argv(2), stacks.c_str(), stacks.length());
+        gi.Printf("Wrote %s\n", gi.Argv(2));
+        return qtrue;
+    }
+
+    if (!g_scriptprofile->integer) {
+        gi.Printf("g_scriptprofile is not set\n");
+    }
+
+    scriptProfiler.PrintTable(gi.Argc() > 1 ? atoi(gi.Argv(1)) : 30);
+
+    return qtrue;
+}
+
+qboolean G_GridStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    entityGrid.PrintStats(reset);
+
+    return qtrue;
+}
+
+qboolean G_SightStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    G_PrintSightCacheStats(reset);
+
+    return qtrue;
+}
+
+qboolean G_AILodStatsCmd(gentity_t *ent)
+{
+    bool reset;
+
+    reset = gi.Argc() > 1 && !Q_stricmp(gi.Argv(1), "reset");
+
+    aiLod.PrintStats(reset);
+
+    return qtrue;
+}
+
+/*
+=================
+G_RadiusBenchCmd
+
+Times radius queries around each entity of the level,
+scanning the active entities like findradius did and using the grid
+=================
+*/
+qboolean G_RadiusBenchCmd(gentity_t *ent)
+{
+    Container<Vector> origins;
+    gentity_t        *from;
+    float             radius;
+    float             r2;
+    int               numQueries;
+    int               numScanned;
+    int               numFound;
+    int               i;
+    int               entityList[MAX_GENTITIES];
+    qctime_t          start;
+    long long         scanTime;
+    long long         gridTime;
+
+    if (!sv_cheats->integer) {
+        gi.Printf("command not available\n");
+        return qtrue;
+    }
+
+    radius     = gi.Argc() > 1 ? atof(gi.Argv(1)) : 512;
+    numQueries = gi.Argc() > 2 ? atoi(gi.Argv(2)) : 10000;
+    if (numQueries < 1) {
+        numQueries = 1;
+    }
+
+    for (from = active_edicts.next; from != &active_edicts; from = from->next) {
+        if (from->entity) {
+            origins.AddObject(from->entity->centroid);
+        }
+    }
+
+    if (!origins.NumObjects()) {
+        gi.Printf("No entities\n");
+        return qtrue;
+    }
+
+    r2 = radius * radius;
+
+    numScanned = 0;
+    start      = qcclock_t::now();
+
+    for (i = 0; i < numQueries; i++) {
+        const Vector& org = origins.ObjectAt(i % origins.NumObjects() + 1);
+
+        for (from = active_edicts.next; from != &active_edicts; from = from->next) {
+            if (from->entity && EntityGrid::InRadius(from, org, r2)) {
+                numScanned++;
+            }
+        }
+    }
+
+    scanTime = std::chrono::duration_cast<std::chrono::microseconds>(qcclock_t::now() - start).count();
+
+    numFound = 0;
+    start    = qcclock_t::now();
+
+    for (i = 0; i < numQueries; i++) {
+        numFound += entityGrid.FindInRadius(
+            origins.ObjectAt(i % origins.NumObjects() + 1), radius, entityList, MAX_GENTITIES
+        );
+    }
+
+    gridTime = std::chrono::duration_cast<std::chrono::microseconds>(qcclock_t::now() - start).count();
+
+    gi.Printf("%d queries of radius %.0f around %d entities:\n", numQueries, radius, origins.NumObjects());
+    gi.Printf("  scan: %lld us, %.1f entities per query\n", scanTime, (float)numScanned / numQueries);
+    gi.Printf("  grid: %lld us, %.1f entities per query\n", gridTime, (float)numFound / numQueries);
+
+    if (numFound != numScanned) {
+        gi.Printf("^~^~^ the grid found %d entities, the scan %d\n", numFound, numScanned);
+    }
+
+    entityGrid.PrintStats(false);
+
+    return qtrue;
+}
+
+qboolean G_BotBenchCmd(gentity_t *ent)
+{
+    int iterations;
+
+    if (!sv_cheats->integer) {
+        gi.Printf("command not available\n");
+        return qtrue;
+    }
+
+    iterations = gi.Argc() > 1 ? atoi(gi.Argv(1)) : 1000;
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    botManager.getControllerManager().BenchmarkEnemySearch(iterations);
+
+    return qtrue;
+}
+
+qboolean G_ScriptBenchCmd(gentity_t *ent)
+{
+    str      filename;
+    str      label;
+    int      iterations;
+    int      startTime;
+    int      elapsed;
+    int      i;
+    qboolean loopProtection;
+
+    if (gi.Argc() <= 1) {
+        gi.Printf("Usage: scriptbench [filename] [label] [iterations]\n");
+        return qtrue;
+    }
+
+    if (!sv_cheats->integer) {
+        gi.Printf("command not available\n");
+        return qtrue;
+    }
+
+    filename   = gi.Argv(1);
+    label      = gi.Argc() > 2 ? gi.Argv(2) : "";
+    iterations = gi.Argc() > 3 ? atoi(gi.Argv(3)) : 1;
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    // compile the script before timing
+    if (!Director.GetScript(filename)) {
+        gi.Printf("Couldn't load script '%s'\n", filename.c_str());
+        return qtrue;
+    }
+
+    // the whole benchmark runs within a frame, it must not be stopped as an infinite loop
+    loopProtection         = level.m_LoopProtection;
+    level.m_LoopProtection = false;
+
+    startTime = gi.Milliseconds();
+    for (i = 0; i < iterations; i++) {
+        Director.ExecuteThread(filename, label);
+    }
+    elapsed = gi.Milliseconds() - startTime;
+
+    level.m_LoopProtection = loopProtection;
+
+    gi.Printf(
+        "%s::%s: %d iterations in %d ms (%.3f ms per iteration)\n",
+        filename.c_str(),
+        label.length() ? label.c_str() : "(start)",
+        iterations,
+        elapsed,
+        (float)elapsed / iterations
+    );
+
+    return qtrue;
+}
+
 qboolean G_AddBotCommand(gentity_t *ent)
 {
     unsigned int numbots;
@@ -42,6 +42,7 @@ qboolean G_SoundCmd(gentity_t *ent);
 qboolean G_SayCmd(gentity_t *ent);
 qboolean G_EventListCmd(gentity_t *ent);
 qboolean G_PendingEventsCmd(gentity_t *ent);
+qboolean G_EventStatsCmd(gentity_t *ent);
 qboolean G_EventHelpCmd(gentity_t *ent);
 qboolean G_DumpEventsCmd(gentity_t *ent);
 qboolean G_ClassEventsCmd(gentity_t *ent);
@@ -56,6 +57,16 @@ qboolean G_GameVarsCmd(gentity_t* ent);
 qboolean G_ScriptCmd(gentity_t* ent);
 qboolean G_ReloadMap(gentity_t* ent);
 qboolean G_CompileScript(gentity_t *ent);
+qboolean G_ScriptBenchCmd(gentity_t *ent);
+qboolean G_ScriptCacheStatsCmd(gentity_t *ent);
+qboolean G_StringStatsCmd(gentity_t *ent);
+qboolean G_ScriptTimesCmd(gentity_t *ent);
+qboolean G_ScriptProfileCmd(gentity_t *ent);
+qboolean G_GridStatsCmd(gentity_t *ent);
+qboolean G_RadiusBenchCmd(gentity_t *ent);
+qboolean G_SightStatsCmd(gentity_t *ent);
+qboolean G_BotBenchCmd(gentity_t *ent);
+qboolean G_AILodStatsCmd(gentity_t *ent);
 qboolean G_AddBotCommand(gentity_t *ent);
 qboolean G_AddBotNamedCommand(gentity_t *ent);
 qboolean G_RemoveBotCommand(gentity_t *ent);
@@ -127,12 +127,22 @@ cvar_t *g_logstats;
 
 cvar_t *g_showtokens;
 cvar_t *g_showopcodes;
+cvar_t *g_scriptoptimize;
+cvar_t *g_scriptcache;
+cvar_t *g_precompilescripts;
+cvar_t *g_scriptbudget;
 cvar_t *g_scriptcheck;
 cvar_t *g_nodecheck;
 cvar_t *g_scriptdebug;
 cvar_t *g_scripttrace;
+cvar_t *g_scriptprofile;
 
 cvar_t *g_ai;
+cvar_t *g_sightcache;
+cvar_t *g_ai_lod;
+cvar_t *g_ai_lod_distance;
+cvar_t *g_ai_lod_far_frames;
+cvar_t *g_ai_lod_hidden_frames;
 cvar_t *g_vehicle;
 
 cvar_t *g_gametype;
@@ -291,6 +301,7 @@ cvar_t *g_bot_attack_spreadmult;
 cvar_t *g_bot_turn_speed;
 cvar_t *g_bot_instamsg_chance;
 cvar_t *g_bot_instamsg_delay;
+cvar_t *g_bot_enemy_candidates;
 cvar_t *g_bot_initial_spawn_delay;
 
 cvar_t *g_rankedserver;
@@ -451,9 +462,33 @@ void CVAR_Init(void)
     g_scriptdebug  = gi.Cvar_Get("g_scriptdebug", "0", 0);
     g_scripttrace  = gi.Cvar_Get("g_scripttrace", "0", 0);
 
+    // times script threads and commands, see the scriptprofile command
+    g_scriptprofile = gi.Cvar_Get("g_scriptprofile", "0", 0);
+
+    // code positions are saved, so scripts must be compiled the same way when loading
+    g_scriptoptimize = gi.Cvar_Get("g_scriptoptimize", "1", CVAR_SAVEGAME);
+
+    // compiled scripts are stored in the home directory and loaded instead of compiling unchanged scripts
+    g_scriptcache = gi.Cvar_Get("g_scriptcache", "1", 0);
+
+    // milliseconds per frame spent compiling the scripts of the maps in the rotation into the script cache
+    g_precompilescripts = gi.Cvar_Get("g_precompilescripts", "0", 0);
+
+    // milliseconds per frame for the waiting threads, past it looping threads continue on the next frame (0 = no limit)
+    g_scriptbudget = gi.Cvar_Get("g_scriptbudget", "0", 0);
+
     g_ai      = gi.Cvar_Get("g_ai", "1", 0);
     g_vehicle = gi.Cvar_Get("g_vehicle", "1", 0);
 
+    // sight traces and obfuscation between the same points are computed once per frame, see the sightstats command
+    g_sightcache = gi.Cvar_Get("g_sightcache", "1", 0);
+
+    // actors and bots far from the clients or out of their sight think less often, see the ailodstats command
+    g_ai_lod               = gi.Cvar_Get("g_ai_lod", "0", 0);
+    g_ai_lod_distance      = gi.Cvar_Get("g_ai_lod_distance", "1536", 0);
+    g_ai_lod_far_frames    = gi.Cvar_Get("g_ai_lod_far_frames", "2", 0);
+    g_ai_lod_hidden_frames = gi.Cvar_Get("g_ai_lod_hidden_frames", "4", 0);
+
     g_monitor    = gi.Cvar_Get("g_monitor", "", 0);
     g_monitorNum = gi.Cvar_Get("g_monitorNum", "-1", 0);
 
@@ -687,6 +722,7 @@ void CVAR_Init(void)
     g_bot_turn_speed                           = gi.Cvar_Get("g_bot_turn_speed", "15", 0);
     g_bot_instamsg_chance                      = gi.Cvar_Get("g_bot_instamsg_chance", "5", 0);
     g_bot_instamsg_delay                       = gi.Cvar_Get("g_bot_instamsg_delay", "5.0", 0);
+    g_bot_enemy_candidates                     = gi.Cvar_Get("g_bot_enemy_candidates", "8", 0);
 
     g_rankedserver               = gi.Cvar_Get("g_rankedserver", "0", 0);
     g_spectatefollow_firstperson = gi.Cvar_Get("g_spectatefollow_firstperson", "0", 0);
@@ -132,12 +132,22 @@ extern cvar_t *g_logstats;
 
 extern cvar_t *g_showtokens;
 extern cvar_t *g_showopcodes;
+extern cvar_t *g_scriptoptimize;
+extern cvar_t *g_scriptcache;
+extern cvar_t *g_precompilescripts;
+extern cvar_t *g_scriptbudget;
 extern cvar_t *g_scriptcheck;
 extern cvar_t *g_nodecheck;
 extern cvar_t *g_scriptdebug;
 extern cvar_t *g_scripttrace;
+extern cvar_t *g_scriptprofile;
 
 extern cvar_t *g_ai;
+extern cvar_t *g_sightcache;
+extern cvar_t *g_ai_lod;
+extern cvar_t *g_ai_lod_distance;
+extern cvar_t *g_ai_lod_far_frames;
+extern cvar_t *g_ai_lod_hidden_frames;
 extern cvar_t *g_vehicle;
 
 extern cvar_t *g_gametype;
@@ -315,6 +325,11 @@ extern cvar_t *g_bot_instamsg_chance;
  * @brief The delay at which the bot can send an instant message again.
  */
 extern cvar_t *g_bot_instamsg_delay;
+/**
+ * @brief The number of nearest enemies the bot checks for visibility when looking for an enemy.
+ * 0 = all enemies, up to MAX_BOT_ENEMY_CANDIDATES
+ */
+extern cvar_t *g_bot_enemy_candidates;
 
 /**
  * @brief The delay before spawning bots at the beginning of the map.
@@ -43,79 +43,84 @@ const_str AbstractScript::ConstFilename(void)
     return m_Filename;
 }
 
-bool AbstractScript::GetSourceAt(size_t sourcePos, str *sourceLine, int& column, int& line)
+void AbstractScript::BuildLineStarts(void)
 {
-    size_t        posLine;
-    size_t        i;
-    size_t        start;
-    char         *p;
-    char          old_token;
-    sourceinfo_t *minCachedInfo = NULL;
+    size_t i;
+    int    numLines;
 
-    if (!m_SourceBuffer || sourcePos >= m_SourceLength) {
-        return false;
+    FreeLineStarts();
+
+    if (!m_SourceBuffer) {
+        return;
     }
 
-    line    = 1;
-    column  = 0;
-    posLine = 0;
-    start   = 0;
+    numLines = 1;
+    for (i = 0; i < m_SourceLength && m_SourceBuffer[i]; i++) {
+        if (m_SourceBuffer[i] == '\n') {
+            numLines++;
+        }
+    }
 
-    p = m_SourceBuffer;
+    m_LineStarts    = (unsigned int *)gi.Malloc(numLines * sizeof(unsigned int));
+    m_LineStarts[0] = 0;
+    m_NumLines      = 1;
 
-    if (sourcePos > 128) {
-        // Start caching above certain values
+    for (i = 0; i < m_SourceLength && m_SourceBuffer[i]; i++) {
+        if (m_SourceBuffer[i] == '\n') {
+            m_LineStarts[m_NumLines++] = i + 1;
+        }
+    }
+}
+
+void AbstractScript::FreeLineStarts(void)
+{
+    if (m_LineStarts) {
+        gi.Free(m_LineStarts);
+        m_LineStarts = NULL;
+    }
 
-        for (i = 0; i < ARRAY_LEN(cachedInfo); i++) {
-            sourceinfo_t *info = &cachedInfo[i];
+    m_NumLines = 0;
+}
 
-            if (info->line && sourcePos > info->sourcePos
-                && (!minCachedInfo || info->sourcePos > minCachedInfo->sourcePos)) {
-                minCachedInfo = info;
-            }
-        }
+bool AbstractScript::GetSourceAt(size_t sourcePos, str *sourceLine, int& column, int& line)
+{
+    size_t start, end;
+    int    low, high, mid;
 
-        if (minCachedInfo) {
-            start   = minCachedInfo->sourcePos;
-            line    = minCachedInfo->line;
-            column  = minCachedInfo->column;
-            posLine = minCachedInfo->startLinePos;
-        }
+    if (!m_SourceBuffer || !m_LineStarts || sourcePos >= m_SourceLength) {
+        return false;
     }
 
-    for (i = start; i < sourcePos; i++) {
-        p = m_SourceBuffer + i;
-        column++;
+    // find the last line starting before or at the position
+    low  = 0;
+    high = m_NumLines - 1;
+    while (low < high) {
+        mid = (low + high + 1) / 2;
 
-        if (*p == '\n') {
-            line++;
-            column = 0;
-            if (i + 1 != sourcePos) {
-                posLine = i + 1;
-            }
-        } else if (*p == '\0') {
-            break;
+        if (m_LineStarts[mid] <= sourcePos) {
+            low = mid;
+        } else {
+            high = mid - 1;
         }
     }
 
-    while (*p != '\0' && (*p != '\r' && *p != '\n')) {
-        p++;
-    }
+    line   = low + 1;
+    column = sourcePos - m_LineStarts[low];
 
-    old_token = *p;
-    *p        = '\0';
+    if (!sourceLine) {
+        return true;
+    }
 
-    if (sourceLine) {
-        *sourceLine = (m_SourceBuffer + posLine);
+    if (!column && low > 0) {
+        // the position follows a newline, show the line that it ends
+        start = m_LineStarts[low - 1];
+    } else {
+        start = m_LineStarts[low];
     }
 
-    *p = old_token;
+    for (end = start; m_SourceBuffer[end] && m_SourceBuffer[end] != '\r' && m_SourceBuffer[end] != '\n'; end++) {}
 
-    cachedInfo[cachedInfoIndex].sourcePos    = sourcePos;
-    cachedInfo[cachedInfoIndex].line         = line;
-    cachedInfo[cachedInfoIndex].column       = column;
-    cachedInfo[cachedInfoIndex].startLinePos = posLine;
-    cachedInfoIndex                          = (cachedInfoIndex + 1) % ARRAY_LEN(cachedInfo);
+    *sourceLine = str(m_SourceBuffer + start, end - start);
 
     return true;
 }
@@ -194,10 +199,11 @@ void AbstractScript::PrintSourcePos(str sourceLine, int column, int line, bool d
 
 AbstractScript::AbstractScript()
 {
-    m_ProgToSource  = NULL;
-    m_SourceBuffer  = NULL;
-    m_SourceLength  = 0;
-    cachedInfoIndex = 0;
+    m_ProgToSource = NULL;
+    m_SourceBuffer = NULL;
+    m_SourceLength = 0;
+    m_LineStarts   = NULL;
+    m_NumLines     = 0;
 }
 
 StateScript::StateScript()
@@ -350,121 +356,250 @@ GameScript::~GameScript()
     Close();
 }
 
-struct pfixup_t {
-    bool          isString;
-    unsigned int *ptr;
+//
+// Operands that are only valid in the current game session, script strings,
+// events and switch state scripts, are replaced by table indexes when a program
+// is archived, and resolved again when it is loaded
+//
+class ProgRelocation
+{
+public:
+    bool saving;
+
+    Container<const_str>      strings;
+    Container<unsigned int>   events;
+    Container<StateScript *> *stateScripts;
+
+private:
+    con_map<const_str, int>    stringIndexes;
+    con_map<unsigned int, int> eventIndexes;
+
+    bool RelocateString(unsigned char *operand);
+    bool RelocateEvent(unsigned char *operand, bool isReturn);
+    bool RelocateStateScript(unsigned char *operand);
+
+public:
+    bool RelocateOpcodes(unsigned char *progBuffer, size_t progLength);
 };
 
-static Container<const_str>  archivedEvents;
-static Container<const_str>  archivedStrings;
-static Container<pfixup_t *> archivedPointerFixup;
+bool ProgRelocation::RelocateString(unsigned char *operand)
+{
+    op_name_t value;
+
+    memcpy(&value, operand, sizeof(value));
+
+    if (saving) {
+        int& index = stringIndexes[value];
 
-void ArchiveOpcode(Archiver& arc, unsigned char *code)
+        if (!index) {
+            index = strings.AddObject(value);
+        }
+
+        value = index;
+    } else {
+        if (value < 1 || value > (op_name_t)strings.NumObjects()) {
+            return false;
+        }
+
+        value = strings.ObjectAt(value);
+    }
+
+    memcpy(operand, &value, sizeof(value));
+    return true;
+}
+
+bool ProgRelocation::RelocateEvent(unsigned char *operand, bool isReturn)
 {
-    unsigned int index;
+    op_ev_t value;
 
-    arc.ArchiveByte(code);
+    memcpy(&value, operand, sizeof(value));
 
-    switch (*code) {
-    case OP_STORE_NIL:
-    case OP_STORE_NULL:
-    case OP_DONE:
-        break;
+    if (!value) {
+        return true;
+    }
+
+    if (saving) {
+        // events are resolved by name, so normal and return commands are distinct entries
+        const unsigned int key   = value * 2 + (isReturn ? 1 : 0);
+        int&               index = eventIndexes[key];
 
-    case OP_EXEC_CMD_COUNT1:
-    case OP_EXEC_CMD_METHOD_COUNT1:
-    case OP_EXEC_METHOD_COUNT1:
-        arc.ArchiveByte(code + 1);
-        goto __exec;
-
-    case OP_EXEC_CMD0:
-    case OP_EXEC_CMD1:
-    case OP_EXEC_CMD2:
-    case OP_EXEC_CMD3:
-    case OP_EXEC_CMD4:
-    case OP_EXEC_CMD5:
-    case OP_EXEC_CMD_METHOD0:
-    case OP_EXEC_CMD_METHOD1:
-    case OP_EXEC_CMD_METHOD2:
-    case OP_EXEC_CMD_METHOD3:
-    case OP_EXEC_CMD_METHOD4:
-    case OP_EXEC_CMD_METHOD5:
-    case OP_EXEC_METHOD0:
-    case OP_EXEC_METHOD1:
-    case OP_EXEC_METHOD2:
-    case OP_EXEC_METHOD3:
-    case OP_EXEC_METHOD4:
-    case OP_EXEC_METHOD5:
-        code--;
-    __exec:
-        if (!arc.Loading()) {
-            index = archivedEvents.AddUniqueObject(*reinterpret_cast<const_str *>(code + 2));
+        if (!index) {
+            index = events.AddObject(key);
+        }
+
+        value = index;
+    } else {
+        if (value > (op_ev_t)events.NumObjects()) {
+            return false;
         }
 
-        arc.ArchiveUnsigned(&index);
+        value = events.ObjectAt(value);
+    }
+
+    memcpy(operand, &value, sizeof(value));
+    return true;
+}
 
-        if (arc.Loading()) {
-            pfixup_t *p = new pfixup_t;
+bool ProgRelocation::RelocateStateScript(unsigned char *operand)
+{
+    StateScript *stateScript;
+    uintptr_t    index;
 
-            p->isString = false;
-            p->ptr      = reinterpret_cast<unsigned int *>(code + 2);
+    memcpy(&stateScript, operand, sizeof(stateScript));
 
-            *reinterpret_cast<unsigned int *>(code + 2) = index;
-            archivedPointerFixup.AddObject(p);
+    if (saving) {
+        index = stateScripts->IndexOfObject(stateScript);
+        if (!index) {
+            return false;
         }
-        break;
 
-    case OP_LOAD_FIELD_VAR:
-    case OP_LOAD_GAME_VAR:
-    case OP_LOAD_GROUP_VAR:
-    case OP_LOAD_LEVEL_VAR:
-    case OP_LOAD_LOCAL_VAR:
-    case OP_LOAD_OWNER_VAR:
-    case OP_LOAD_PARM_VAR:
-    case OP_LOAD_SELF_VAR:
-    case OP_LOAD_STORE_GAME_VAR:
-    case OP_LOAD_STORE_GROUP_VAR:
-    case OP_LOAD_STORE_LEVEL_VAR:
-    case OP_LOAD_STORE_LOCAL_VAR:
-    case OP_LOAD_STORE_OWNER_VAR:
-    case OP_LOAD_STORE_PARM_VAR:
-    case OP_LOAD_STORE_SELF_VAR:
-    case OP_STORE_FIELD:
-    case OP_STORE_FIELD_REF:
-    case OP_STORE_GAME_VAR:
-    case OP_STORE_GROUP_VAR:
-    case OP_STORE_LEVEL_VAR:
-    case OP_STORE_LOCAL_VAR:
-    case OP_STORE_OWNER_VAR:
-    case OP_STORE_PARM_VAR:
-    case OP_STORE_SELF_VAR:
-    case OP_STORE_STRING:
-        if (!arc.Loading()) {
-            index = archivedStrings.AddUniqueObject(*reinterpret_cast<const_str *>(code + 1));
+        memcpy(operand, &index, sizeof(index));
+    } else {
+        memcpy(&index, operand, sizeof(index));
+        if (index < 1 || index > (uintptr_t)stateScripts->NumObjects()) {
+            return false;
         }
 
-        arc.ArchiveUnsigned(&index);
+        stateScript = stateScripts->ObjectAt(index);
+        memcpy(operand, &stateScript, sizeof(stateScript));
+    }
 
-        if (arc.Loading()) {
-            pfixup_t *p = new pfixup_t;
+    return true;
+}
 
-            p->isString = true;
-            p->ptr      = reinterpret_cast<unsigned int *>(code + 1);
+bool ProgRelocation::RelocateOpcodes(unsigned char *progBuffer, size_t progLength)
+{
+    unsigned char *code = progBuffer;
+    unsigned char *end  = progBuffer + progLength;
+    size_t         length;
+    bool           success;
+
+    while (code < end) {
+        if (*code == OP_DONE) {
+            length = 1;
+        } else if (*code < OP_MAX && *code != OP_FUNC) {
+            length = OpcodeLength(*code);
+        } else {
+            // function calls have a variable length and are never emitted by the compiler
+            return false;
+        }
 
-            *reinterpret_cast<unsigned int *>(code + 1) = index;
-            archivedPointerFixup.AddObject(p);
+        if (!length || code + length > end) {
+            return false;
         }
-        break;
 
-    default:
-        if (OpcodeLength(*code) > 1) {
-            arc.ArchiveRaw(code + 1, OpcodeLength(*code) - 1);
+        switch (*code) {
+        case OP_EXEC_CMD0:
+        case OP_EXEC_CMD1:
+        case OP_EXEC_CMD2:
+        case OP_EXEC_CMD3:
+        case OP_EXEC_CMD4:
+        case OP_EXEC_CMD5:
+        case OP_EXEC_CMD_METHOD0:
+        case OP_EXEC_CMD_METHOD1:
+        case OP_EXEC_CMD_METHOD2:
+        case OP_EXEC_CMD_METHOD3:
+        case OP_EXEC_CMD_METHOD4:
+        case OP_EXEC_CMD_METHOD5:
+            success = RelocateEvent(code + 1, false);
+            break;
+
+        case OP_EXEC_METHOD0:
+        case OP_EXEC_METHOD1:
+        case OP_EXEC_METHOD2:
+        case OP_EXEC_METHOD3:
+        case OP_EXEC_METHOD4:
+        case OP_EXEC_METHOD5:
+            success = RelocateEvent(code + 1, true);
+            break;
+
+        case OP_EXEC_CMD_COUNT1:
+        case OP_EXEC_CMD_METHOD_COUNT1:
+            success = RelocateEvent(code + 1 + sizeof(op_parmNum_t), false);
+            break;
+
+        case OP_EXEC_METHOD_COUNT1:
+            success = RelocateEvent(code + 1 + sizeof(op_parmNum_t), true);
+            break;
+
+        case OP_EXEC_CMD_METHOD_LOCAL_VAR:
+            success = RelocateString(code + 1)
+                   && RelocateEvent(code + 1 + sizeof(op_name_t) + sizeof(op_parmNum_t), false);
+            break;
+
+        case OP_EXEC_METHOD_LOCAL_VAR:
+            success = RelocateString(code + 1)
+                   && RelocateEvent(code + 1 + sizeof(op_name_t) + sizeof(op_parmNum_t), true);
+            break;
+
+        case OP_LOAD_FIELD_VAR:
+        case OP_LOAD_GAME_VAR:
+        case OP_LOAD_GROUP_VAR:
+        case OP_LOAD_LEVEL_VAR:
+        case OP_LOAD_LOCAL_VAR:
+        case OP_LOAD_OWNER_VAR:
+        case OP_LOAD_PARM_VAR:
+        case OP_LOAD_SELF_VAR:
+        case OP_LOAD_STORE_GAME_VAR:
+        case OP_LOAD_STORE_GROUP_VAR:
+        case OP_LOAD_STORE_LEVEL_VAR:
+        case OP_LOAD_STORE_LOCAL_VAR:
+        case OP_LOAD_STORE_OWNER_VAR:
+        case OP_LOAD_STORE_PARM_VAR:
+        case OP_LOAD_STORE_SELF_VAR:
+        case OP_STORE_FIELD:
+        case OP_STORE_FIELD_REF:
+        case OP_STORE_GAME_VAR:
+        case OP_STORE_GROUP_VAR:
+        case OP_STORE_LEVEL_VAR:
+        case OP_STORE_LOCAL_VAR:
+        case OP_STORE_OWNER_VAR:
+        case OP_STORE_PARM_VAR:
+        case OP_STORE_SELF_VAR:
+        case OP_STORE_STRING:
+        case OP_UN_INC_LOCAL_VAR:
+        case OP_UN_DEC_LOCAL_VAR:
+            success = RelocateString(code + 1);
+            break;
+
+        case OP_STORE_LOCAL_VAR2:
+            success = RelocateString(code + 1) && RelocateString(code + 1 + sizeof(op_name_t));
+            break;
+
+        case OP_SWITCH:
+            success = RelocateStateScript(code + 1);
+            break;
+
+        default:
+            success = true;
+            break;
+        }
+
+        if (!success) {
+            return false;
         }
+
+        code += length;
+    }
+
+    return true;
+}
+
+static void ArchiveProgPos(Archiver& arc, unsigned char **pos)
+{
+    unsigned int offset;
+
+    if (arc.Saving()) {
+        offset = *pos - current_progBuffer;
+        arc.ArchiveUnsigned(&offset);
+    } else {
+        arc.ArchiveUnsigned(&offset);
+        *pos = current_progBuffer + offset;
     }
 }
 
 template<>
-void con_set<unsigned char *, sourceinfo_t>::Entry::Archive(Archiver& arc)
+void con_set<const unsigned char *, sourceinfo_t>::Entry::Archive(Archiver& arc)
 {
     unsigned int offset;
 
@@ -481,167 +616,168 @@ void con_set<unsigned char *, sourceinfo_t>::Entry::Archive(Archiver& arc)
     arc.ArchiveInteger(&value.line);
 }
 
+// The compiled program is archived, so that it can be loaded without compiling the source again
 void GameScript::Archive(Archiver& arc)
 {
-    /*
-	int count = 0, i;
-	unsigned char *p, *code_pos, *code_end;
-	const_str s;
-	command_t *c, cmd;
-
-	arc.ArchiveSize( ( long * )&m_ProgLength );
-
-	if( arc.Saving() )
-	{
-		p = m_ProgBuffer;
-		current_progBuffer = m_ProgBuffer;
-
-		// archive opcodes
-		while( *p != OP_DONE )
-		{
-			ArchiveOpcode( arc, p );
-
-			p += OpcodeLength( *p );
-		}
-
-		ArchiveOpcode( arc, p );
-
-		// archive string dictionary list
-		i = archivedStrings.NumObjects();
-		arc.ArchiveInteger( &i );
-
-		for( ; i > 0; i-- )
-		{
-			Director.ArchiveString( arc, archivedStrings.ObjectAt( i ) );
-		}
-
-		// archive event list
-		i = archivedEvents.NumObjects();
-		arc.ArchiveInteger( &i );
-
-		for( ; i > 0; i-- )
-		{
-			c = Event::GetEventInfo( archivedEvents.ObjectAt( i ) );
-
-			arc.ArchiveString( &c->command );
-			arc.ArchiveInteger( &c->flags );
-			arc.ArchiveByte( &c->type );
-		}
-	}
-	else
-	{
-		m_ProgBuffer = ( unsigned char * )gi.Malloc( m_ProgLength );
-		code_pos = m_ProgBuffer;
-		code_end = m_ProgBuffer + m_ProgLength;
-
-		current_progBuffer = m_ProgBuffer;
-
-		do
-		{
-			ArchiveOpcode( arc, code_pos );
-
-			code_pos += OpcodeLength( *code_pos );
-		} while( *code_pos != OP_DONE && arc.NoErrors() );
-
-		if( !arc.NoErrors() )
-		{
-			return;
-		}
-
-		// retrieve the string dictionary list
-		arc.ArchiveInteger( &i );
-		archivedStrings.Resize( i + 1 );
-
-		for( ; i > 0; i-- )
-		{
-			Director.ArchiveString( arc, s );
-			archivedStrings.AddObjectAt( i, s );
-		}
-
-		// retrieve the event list
-		arc.ArchiveInteger( &i );
-		archivedEvents.Resize( i + 1 );
-
-		for( ; i > 0; i-- )
-		{
-			arc.ArchiveString( &cmd.command );
-			arc.ArchiveInteger( &cmd.flags );
-			arc.ArchiveByte( &cmd.type );
-
-			archivedEvents.AddObjectAt( i, Event::GetEventWithFlags( cmd.command, cmd.flags, cmd.type ) );
-		}
-
-		// fix program string/event pointers
-		for( i = archivedPointerFixup.NumObjects(); i > 0; i-- )
-		{
-			pfixup_t *fixup = archivedPointerFixup.ObjectAt( i );
-
-			if( fixup->isString )
-			{
-				*fixup->ptr = archivedStrings.ObjectAt( *fixup->ptr );
-			}
-			else
-			{
-				*fixup->ptr = archivedEvents.ObjectAt( *fixup->ptr );
-			}
-
-			delete fixup;
-		}
-
-		successCompile = true;
-	}
-
-	// cleanup
-	archivedStrings.FreeObjectList();
-	archivedEvents.FreeObjectList();
-	archivedPointerFixup.FreeObjectList();
-
-	if( !arc.Loading() )
-	{
-		if( m_ProgToSource )
-		{
-			count = m_ProgToSource->size();
-			arc.ArchiveInteger( &count );
-
-			m_ProgToSource->Archive( arc );
-		}
-		else
-		{
-			arc.ArchiveInteger( &count );
-		}
-	}
-	else
-	{
-		arc.ArchiveInteger( &count );
-
-		if( count )
-		{
-			m_ProgToSource = new con_set < unsigned char *, sourceinfo_t >;
-			m_ProgToSource->Archive( arc );
-		}
-	}
-
-	arc.ArchiveUnsigned( &requiredStackSize );
-	arc.ArchiveBool( &m_bPrecompiled );
-
-	if( !m_bPrecompiled && arc.Loading() )
-	{
-		fileHandle_t filehandle = NULL;
-
-		m_SourceLength = gi.FS_ReadFile( Filename().c_str(), ( void ** )&m_SourceBuffer, true );
-
-		if( m_SourceLength > 0 )
-		{
-			m_SourceBuffer = ( char * )gi.Malloc( m_SourceLength );
-
-			gi.FS_Read( m_SourceBuffer, m_SourceLength, filehandle );
-			gi.FS_FCloseFile( filehandle );
-		}
-	}
-
-	m_State.Archive( arc );
-
-	current_progBuffer = NULL;*/
+    ProgRelocation relocation;
+    unsigned char *progBuffer;
+    unsigned int   progLength;
+    CatchBlock    *catchBlock;
+    const_str      s;
+    str            name;
+    bool           isReturn;
+    bool           hasSourceInfo;
+    unsigned int   eventnum;
+    int            num;
+    int            i;
+
+    relocation.saving       = arc.Saving() ? true : false;
+    relocation.stateScripts = &m_StateScripts;
+
+    if (relocation.saving) {
+        // operands are replaced in a copy, the program may still be running
+        progLength = m_ProgLength;
+        progBuffer = (unsigned char *)gi.Malloc(progLength);
+        memcpy(progBuffer, m_ProgBuffer, progLength);
+
+        if (!relocation.RelocateOpcodes(progBuffer, progLength)) {
+            gi.Free(progBuffer);
+            arc.FileError("Program of '%s' can't be archived.", Filename().c_str());
+            return;
+        }
+
+        arc.ArchiveUnsigned(&progLength);
+        arc.ArchiveRaw(progBuffer, progLength);
+        gi.Free(progBuffer);
+
+        num = relocation.strings.NumObjects();
+        arc.ArchiveInteger(&num);
+
+        for (i = 1; i <= num; i++) {
+            Director.ArchiveString(arc, relocation.strings.ObjectAt(i));
+        }
+
+        num = relocation.events.NumObjects();
+        arc.ArchiveInteger(&num);
+
+        for (i = 1; i <= num; i++) {
+            name     = Event::GetEventName(relocation.events.ObjectAt(i) / 2);
+            isReturn = (relocation.events.ObjectAt(i) & 1) ? true : false;
+
+            arc.ArchiveString(&name);
+            arc.ArchiveBool(&isReturn);
+        }
+    } else {
+        arc.ArchiveUnsigned(&progLength);
+        if (!arc.NoErrors()) {
+            return;
+        }
+
+        if (!progLength) {
+            arc.FileError("Empty program.");
+            return;
+        }
+
+        m_ProgBuffer = (unsigned char *)gi.Malloc(progLength);
+        m_ProgLength = progLength;
+        arc.ArchiveRaw(m_ProgBuffer, progLength);
+
+        arc.ArchiveInteger(&num);
+        if (!arc.NoErrors()) {
+            return;
+        }
+
+        relocation.strings.Resize(num);
+
+        for (i = 1; i <= num; i++) {
+            Director.ArchiveString(arc, s);
+            relocation.strings.AddObject(s);
+        }
+
+        arc.ArchiveInteger(&num);
+        if (!arc.NoErrors()) {
+            return;
+        }
+
+        relocation.events.Resize(num);
+
+        for (i = 1; i <= num; i++) {
+            arc.ArchiveString(&name);
+            arc.ArchiveBool(&isReturn);
+            if (!arc.NoErrors()) {
+                return;
+            }
+
+            eventnum = isReturn ? Event::FindReturnEventNum(name) : Event::FindNormalEventNum(name);
+            if (!eventnum) {
+                arc.FileError("Unknown command '%s'.", name.c_str());
+                return;
+            }
+
+            relocation.events.AddObject(eventnum);
+        }
+    }
+
+    current_progBuffer = m_ProgBuffer;
+
+    // switch labels
+    num = m_StateScripts.NumObjects();
+    arc.ArchiveInteger(&num);
+
+    for (i = 1; i <= num && arc.NoErrors(); i++) {
+        if (!relocation.saving) {
+            CreateSwitchStateScript();
+        }
+
+        m_StateScripts.ObjectAt(i)->Archive(arc);
+    }
+
+    // try blocks
+    num = m_CatchBlocks.NumObjects();
+    arc.ArchiveInteger(&num);
+
+    for (i = 1; i <= num && arc.NoErrors(); i++) {
+        if (!relocation.saving) {
+            CreateCatchStateScript(NULL, NULL);
+        }
+
+        catchBlock = m_CatchBlocks.ObjectAt(i);
+
+        ArchiveProgPos(arc, &catchBlock->m_TryStartCodePos);
+        ArchiveProgPos(arc, &catchBlock->m_TryEndCodePos);
+        catchBlock->m_StateScript.Archive(arc);
+    }
+
+    if (!arc.NoErrors()) {
+        current_progBuffer = NULL;
+        return;
+    }
+
+    m_State.Archive(arc);
+
+    hasSourceInfo = m_ProgToSource != NULL;
+    arc.ArchiveBool(&hasSourceInfo);
+
+    if (hasSourceInfo && arc.NoErrors()) {
+        if (!relocation.saving) {
+            m_ProgToSource = new con_set<const unsigned char *, sourceinfo_t>;
+        }
+
+        m_ProgToSource->Archive(arc);
+    }
+
+    arc.ArchiveUnsigned(&requiredStackSize);
+
+    current_progBuffer = NULL;
+
+    if (!relocation.saving && arc.NoErrors()) {
+        if (!relocation.RelocateOpcodes(m_ProgBuffer, m_ProgLength)) {
+            arc.FileError("Invalid program.");
+            return;
+        }
+
+        successCompile = true;
+    }
 }
 
 void GameScript::Archive(Archiver& arc, GameScript *& scr)
@@ -698,6 +834,8 @@ void GameScript::Close(void)
     }
 
     m_CatchBlocks.FreeObjectList();
+    m_StateScripts.FreeObjectList();
+    m_State.label_list.clear();
 
     if (m_ProgToSource) {
         delete m_ProgToSource;
@@ -714,16 +852,15 @@ void GameScript::Close(void)
         m_SourceBuffer = NULL;
     }
 
+    FreeLineStarts();
+
     m_ProgLength   = 0;
     m_SourceLength = 0;
     m_bPrecompiled = false;
 }
 
-void GameScript::Load(const void *sourceBuffer, size_t sourceLength)
+void GameScript::LoadSource(const void *sourceBuffer, size_t sourceLength)
 {
-    size_t nodeLength;
-    char  *m_PreprocessedBuffer;
-
     m_SourceBuffer = (char *)gi.Malloc(sourceLength + 2);
     m_SourceLength = sourceLength;
 
@@ -735,6 +872,16 @@ void GameScript::Load(const void *sourceBuffer, size_t sourceLength)
 
     memcpy(m_SourceBuffer, sourceBuffer, sourceLength);
 
+    BuildLineStarts();
+}
+
+void GameScript::Load(const void *sourceBuffer, size_t sourceLength)
+{
+    size_t nodeLength;
+    char  *m_PreprocessedBuffer;
+
+    LoadSource(sourceBuffer, sourceLength);
+
     Compiler.Reset();
 
     m_PreprocessedBuffer = Compiler.Preprocess(m_SourceBuffer);
@@ -41,7 +41,6 @@ typedef struct {
 
 struct sourceinfo_t {
     unsigned int sourcePos;
-    unsigned int startLinePos;
     int          column;
     int          line;
 
@@ -63,12 +62,15 @@ public:
     // Developper variable
     con_set<const uchar *, sourceinfo_t> *m_ProgToSource;
 
-    sourceinfo_t cachedInfo[16];
-    size_t       cachedInfoIndex;
+    // Offset of the start of each line in the source
+    unsigned int *m_LineStarts;
+    int           m_NumLines;
 
 public:
     AbstractScript();
 
+    void      BuildLineStarts(void);
+    void      FreeLineStarts(void);
     str&      Filename(void);
     const_str ConstFilename(void);
     bool      GetSourceAt(size_t sourcePos, str *sourceLine, int& column, int& line);
@@ -144,6 +146,7 @@ public:
     void        ArchiveCodePos(Archiver& arc, unsigned char **codePos);
 
     void Close(void);
+    void LoadSource(const void *sourceBuffer, size_t sourceLength);
     void Load(const void *sourceBuffer, size_t sourceLength);
 
     bool GetCodePos(unsigned char *codePos, str& filename, int& pos);
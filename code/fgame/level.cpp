@@ -34,6 +34,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "player.h"
 #include "Entities.h"
 #include "health.h"
+#include "entitygrid.h"
 
 #include "navigation_recast_load.h"
 
@@ -869,6 +870,9 @@ void Level::CleanUp(qboolean samemap, qboolean resetConfigStrings)
 
     Director.Reset(samemap);
 
+    // frame numbers start again
+    G_InvalidateSightCache();
+
     ClearCachedStatemaps();
 
     // clear active current bots
@@ -1809,6 +1813,8 @@ void Level::FreeEdict(gentity_t *ed)
 
     // unlink from world
     gi.unlinkentity(ed);
+    entityGrid.Unlink(ed);
+    G_UpdateSightBlocker(ed, ed->r.absmin, ed->r.absmax);
 
     LL_Remove(ed, next, prev);
 
@@ -33,6 +33,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "weaputils.h"
 #include "windows.h"
 #include "g_bot.h"
+#include "ailod.h"
 
 // We assume that we have limited access to the server-side
 // and that most logic come from the playerstate_s structure
@@ -174,7 +175,11 @@ void BotController::UpdateBotStates(void)
     m_botEyes.angles[0] = 0;
     m_botEyes.angles[1] = 0;
 
-    CheckStates();
+    // movement and aiming go on while the states aren't checked
+    if (aiLod.ShouldThink(controlledEnt, m_pEnemy || m_iAttackTime)) {
+        CheckStates();
+        aiLod.EndThink();
+    }
 
     movement.MoveThink(m_botCmd);
     rotation.TurnThink(m_botCmd, m_botEyes);
@@ -755,14 +760,20 @@ bool BotController::IsValidEnemy(Sentient *sent) const
 
 bool BotController::CheckCondition_Attack(void)
 {
-    Container<Sentient *> sents       = SentientList;
-    float                 maxDistance = 0;
+    Sentient *sents[MAX_BOT_ENEMY_CANDIDATES];
+    int       numSents;
+    int       maxCandidates;
+    float     maxDistance = 0;
+
+    maxCandidates = g_bot_enemy_candidates->integer;
+    if (maxCandidates <= 0 || maxCandidates > MAX_BOT_ENEMY_CANDIDATES) {
+        maxCandidates = MAX_BOT_ENEMY_CANDIDATES;
+    }
 
-    bot_origin = controlledEnt->origin;
-    sents.Sort(sentients_compare);
+    numSents = botManager.getControllerManager().getEnemyCandidates().FindNearest(controlledEnt, sents, maxCandidates);
 
-    for (int i = 1; i <= sents.NumObjects(); i++) {
-        Sentient *sent = sents.ObjectAt(i);
+    for (int i = 0; i < numSents; i++) {
+        Sentient *sent = sents[i];
 
         if (!IsValidEnemy(sent)) {
             continue;
@@ -1319,23 +1330,44 @@ BotController *BotControllerManager::createController(Player *player)
     controller->setControlledEntity(player);
 
     controllers.AddObject(controller);
+    clientControllers[player->entnum] = controller;
 
     return controller;
 }
 
 void BotControllerManager::removeController(BotController *controller)
 {
+    int i;
+
+    for (i = 0; i < MAX_CLIENTS; i++) {
+        if (clientControllers[i] == controller) {
+            clientControllers[i] = nullptr;
+        }
+    }
+
     controllers.RemoveObject(controller);
     delete controller;
 }
 
 BotController *BotControllerManager::findController(Entity *ent)
 {
-    int i;
+    BotController *controller;
+    int            i;
 
+    if (ent && ent->entnum >= 0 && ent->entnum < MAX_CLIENTS) {
+        controller = clientControllers[ent->entnum];
+        if (controller && controller->getControlledEntity() == ent) {
+            return controller;
+        }
+    }
+
+    // not indexed yet, or the bot was shifted to another client slot
     for (i = 1; i <= controllers.NumObjects(); i++) {
-        BotController *controller = controllers.ObjectAt(i);
+        controller = controllers.ObjectAt(i);
         if (controller->getControlledEntity() == ent) {
+            if (ent && ent->entnum >= 0 && ent->entnum < MAX_CLIENTS) {
+                clientControllers[ent->entnum] = controller;
+            }
             return controller;
         }
     }
@@ -1348,6 +1380,11 @@ const Container<BotController *>& BotControllerManager::getControllers() const
     return controllers;
 }
 
+BotControllerManager::BotControllerManager()
+{
+    memset(clientControllers, 0, sizeof(clientControllers));
+}
+
 BotControllerManager::~BotControllerManager()
 {
     Cleanup();
@@ -1370,6 +1407,8 @@ void BotControllerManager::Cleanup()
     }
 
     controllers.FreeObjectList();
+    memset(clientControllers, 0, sizeof(clientControllers));
+    enemyCandidates.Clear();
 }
 
 void BotControllerManager::ThinkControllers()
@@ -1393,8 +1432,225 @@ void BotControllerManager::ThinkControllers()
         }
     }
 
+    if (controllers.NumObjects()) {
+        enemyCandidates.Update();
+    }
+
     for (i = 1; i <= controllers.NumObjects(); i++) {
         BotController *controller = controllers.ObjectAt(i);
         controller->Think();
     }
 }
+
+const BotEnemyCandidates& BotControllerManager::getEnemyCandidates() const
+{
+    return enemyCandidates;
+}
+
+/*
+====================
+BenchmarkEnemySearch
+
+Times the search of the enemies of all bots, copying and sorting the sentient list
+for each bot like the attack check did, and querying the shared candidates
+====================
+*/
+void BotControllerManager::BenchmarkEnemySearch(int iterations)
+{
+    Sentient *list[MAX_BOT_ENEMY_CANDIDATES];
+    qctime_t  start;
+    long long sortTime;
+    long long candidatesTime;
+    int       numBots;
+    int       i, j;
+
+    numBots = 0;
+    for (i = 1; i <= controllers.NumObjects(); i++) {
+        if (controllers.ObjectAt(i)->getControlledEntity()) {
+            numBots++;
+        }
+    }
+
+    start = qcclock_t::now();
+
+    for (i = 0; i < iterations; i++) {
+        for (j = 1; j <= controllers.NumObjects(); j++) {
+            Player *player = controllers.ObjectAt(j)->getControlledEntity();
+            if (!player) {
+                continue;
+            }
+
+            Container<Sentient *> sents = SentientList;
+
+            bot_origin = player->origin;
+            sents.Sort(sentients_compare);
+        }
+    }
+
+    sortTime = std::chrono::duration_cast<std::chrono::microseconds>(qcclock_t::now() - start).count();
+
+    start = qcclock_t::now();
+
+    for (i = 0; i < iterations; i++) {
+        enemyCandidates.Update();
+
+        for (j = 1; j <= controllers.NumObjects(); j++) {
+            Player *player = controllers.ObjectAt(j)->getControlledEntity();
+            if (!player) {
+                continue;
+            }
+
+            enemyCandidates.FindNearest(player, list, MAX_BOT_ENEMY_CANDIDATES);
+        }
+    }
+
+    candidatesTime = std::chrono::duration_cast<std::chrono::microseconds>(qcclock_t::now() - start).count();
+
+    gi.Printf("%d bots, %d sentients, %d frames:\n", numBots, SentientList.NumObjects(), iterations);
+    gi.Printf("  sorted copies: %lld us (%.3f ms per frame)\n", sortTime, sortTime / 1000.0 / iterations);
+    gi.Printf(
+        "  candidates:    %lld us (%.3f ms per frame)\n", candidatesTime, candidatesTime / 1000.0 / iterations
+    );
+}
+
+static int candidates_compare(const void *elem1, const void *elem2)
+{
+    const botCandidate_t *c1 = (const botCandidate_t *)elem1;
+    const botCandidate_t *c2 = (const botCandidate_t *)elem2;
+
+    if (c1->isPlayer != c2->isPlayer) {
+        return c1->isPlayer ? 1 : -1;
+    }
+
+    if (c1->team != c2->team) {
+        return c1->team < c2->team ? -1 : 1;
+    }
+
+    return c1->entnum - c2->entnum;
+}
+
+/*
+====================
+Update
+
+Gathers the sentients that can be attacked by a bot of another team.
+Must be called each frame before the bots think.
+====================
+*/
+void BotEnemyCandidates::Update()
+{
+    botCandidate_t     *candidate;
+    botCandidateTeam_t *team;
+    int                 i;
+
+    // the lists keep their allocation from the previous frames
+    candidates.ClearObjectList();
+    teams.ClearObjectList();
+
+    for (i = 1; i <= SentientList.NumObjects(); i++) {
+        Sentient *sent = SentientList.ObjectAt(i);
+
+        // the checks of BotController::IsValidEnemy that don't depend on the bot
+        if (sent->hidden() || (sent->flags & FL_NOTARGET) || sent->IsDead() || sent->getSolidType() == SOLID_NOT) {
+            continue;
+        }
+
+        candidate         = &candidates.ObjectAt(candidates.AddObject());
+        candidate->sent   = sent;
+        candidate->entnum = sent->entnum;
+
+        if (sent->IsSubclassOfPlayer()) {
+            candidate->team     = static_cast<Player *>(sent)->GetTeam();
+            candidate->isPlayer = true;
+        } else {
+            candidate->team     = sent->m_Team;
+            candidate->isPlayer = false;
+        }
+    }
+
+    candidates.Sort(candidates_compare);
+
+    team = NULL;
+    for (i = 1; i <= candidates.NumObjects(); i++) {
+        candidate = &candidates.ObjectAt(i);
+
+        if (!team || team->team != candidate->team || team->isPlayer != candidate->isPlayer) {
+            team           = &teams.ObjectAt(teams.AddObject());
+            team->team     = candidate->team;
+            team->isPlayer = candidate->isPlayer;
+            team->first    = i;
+        }
+
+        team->last = i;
+    }
+}
+
+void BotEnemyCandidates::Clear()
+{
+    candidates.FreeObjectList();
+    teams.FreeObjectList();
+}
+
+/*
+====================
+FindNearest
+
+Fills list with the nearest candidates of the other teams, the nearest first.
+The candidates must still be checked with BotController::IsValidEnemy,
+they may have changed since the beginning of the frame.
+====================
+*/
+int BotEnemyCandidates::FindNearest(Player *bot, Sentient **list, int maxCount) const
+{
+    float distances[MAX_BOT_ENEMY_CANDIDATES];
+    float distance;
+    int   count;
+    int   i, j, k;
+
+    if (maxCount > MAX_BOT_ENEMY_CANDIDATES) {
+        maxCount = MAX_BOT_ENEMY_CANDIDATES;
+    }
+
+    count = 0;
+
+    for (i = 1; i <= teams.NumObjects(); i++) {
+        const botCandidateTeam_t& team = teams.ObjectAt(i);
+
+        if (team.isPlayer) {
+            if (g_gametype->integer >= GT_TEAM && team.team == bot->GetTeam()) {
+                continue;
+            }
+        } else if (team.team == bot->m_Team) {
+            continue;
+        }
+
+        for (j = team.first; j <= team.last; j++) {
+            const botCandidate_t& candidate = candidates.ObjectAt(j);
+            gentity_t            *ed        = &g_entities[candidate.entnum];
+
+            // the sentient may have been removed during the frame
+            if (!ed->inuse || ed->entity != candidate.sent || candidate.sent == bot) {
+                continue;
+            }
+
+            distance = (bot->origin - candidate.sent->origin).lengthSquared();
+
+            if (count == maxCount && distance >= distances[count - 1]) {
+                continue;
+            }
+
+            // insert it in the sorted list, dropping the farthest one if it's full
+            k = count < maxCount ? count++ : count - 1;
+
+            for (; k > 0 && distances[k - 1] > distance; k--) {
+                distances[k] = distances[k - 1];
+                list[k]      = list[k - 1];
+            }
+
+            distances[k] = distance;
+            list[k]      = candidate.sent;
+        }
+    }
+
+    return count;
+}
@@ -289,12 +289,45 @@ private:
     SafePtr<Player> controlledEnt;
 };
 
+#define MAX_BOT_ENEMY_CANDIDATES 64
+
+typedef struct {
+    Sentient *sent;
+    int       entnum;
+    int       team; // GetTeam() of the players, m_Team of the other sentients
+    bool      isPlayer;
+} botCandidate_t;
+
+typedef struct {
+    int  team;
+    bool isPlayer;
+    int  first; // candidates of the team, starting at 1
+    int  last;
+} botCandidateTeam_t;
+
+/*
+ * The sentients bots can attack, gathered once per frame for all bots
+ * and partitioned by team, so each bot only measures the distance to the other teams.
+ */
+class BotEnemyCandidates
+{
+public:
+    void Update();
+    void Clear();
+    int  FindNearest(Player *bot, Sentient **list, int maxCount) const;
+
+private:
+    Container<botCandidate_t>     candidates;
+    Container<botCandidateTeam_t> teams;
+};
+
 class BotControllerManager : public Listener
 {
 public:
     CLASS_PROTOTYPE(BotControllerManager);
 
 public:
+    BotControllerManager();
     ~BotControllerManager();
 
     BotController                    *createController(Player *player);
@@ -306,8 +339,13 @@ public:
     void Cleanup();
     void ThinkControllers();
 
+    const BotEnemyCandidates& getEnemyCandidates() const;
+    void                      BenchmarkEnemySearch(int iterations);
+
 private:
     Container<BotController *> controllers;
+    BotController             *clientControllers[MAX_CLIENTS]; // controllers by entity number of their player
+    BotEnemyCandidates         enemyCandidates;
 };
 
 class BotManager : public Listener
@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "scriptexception.h"
 #include "vehicleturret.h"
 #include "weaputils.h"
+#include "entitygrid.h"
 
 BotManager botManager;
 
@@ -56,17 +57,43 @@ void BotManager::Frame()
     botControllerManager.ThinkControllers();
 }
 
+static void BotNoticeEvent(
+    BotController *controller, Entity *originator, Vector origin, int iType, float r2, int iAreaNum
+)
+{
+    Sentient *ent;
+    Vector    delta;
+    float     dist2;
+
+    ent = controller->getControlledEntity();
+    if (!ent || ent == originator || ent->deadflag) {
+        return;
+    }
+
+    delta = origin - ent->centroid;
+
+    // dot product returns length squared
+    dist2 = Square(delta);
+
+    if (dist2 > r2) {
+        return;
+    }
+
+    if (iAreaNum != ent->edict->r.areanum && !gi.AreasConnected(iAreaNum, ent->edict->r.areanum)) {
+        return;
+    }
+
+    controller->NoticeEvent(origin, iType, originator, dist2, r2);
+}
+
 void BotManager::BroadcastEvent(Entity *originator, Vector origin, int iType, float radius)
 {
-    Sentient      *ent;
-    Actor         *act;
-    Vector         delta;
-    str            name;
     float          r2;
-    float          dist2;
     int            i;
-    int            iNumSentients;
+    int            iNumEntities;
     int            iAreaNum;
+    int            entityList[MAX_GENTITIES];
+    gentity_t     *ed;
     BotController *controller;
 
     if (radius <= 0.0f) {
@@ -75,36 +102,34 @@ void BotManager::BroadcastEvent(Entity *originator, Vector origin, int iType, fl
 
     assert(originator);
 
+    if (originator) {
+        iAreaNum = originator->edict->r.areanum;
+    } else {
+        iAreaNum = gi.AreaForPoint(origin);
+    }
+
     r2 = Square(radius);
 
     const Container<BotController *>& controllers = getControllerManager().getControllers();
-    for (i = 1; i <= controllers.NumObjects(); i++) {
-        controller = controllers.ObjectAt(i);
-        ent        = controller->getControlledEntity();
-        if (!ent || ent == originator || ent->deadflag) {
-            continue;
-        }
-
-        delta = origin - ent->centroid;
 
-        // dot product returns length squared
-        dist2 = Square(delta);
-
-        if (originator) {
-            iAreaNum = originator->edict->r.areanum;
-        } else {
-            iAreaNum = gi.AreaForPoint(origin);
+    if (entityGrid.QueryCost(radius) < controllers.NumObjects()) {
+        // bots are clients, the first entities
+        iNumEntities = entityGrid.FindInRadius(origin, radius, entityList, MAX_GENTITIES);
+        for (i = 0; i < iNumEntities && entityList[i] < game.maxclients; i++) {
+            ed = &g_entities[entityList[i]];
+            if (!(ed->r.svFlags & SVF_BOT)) {
+                continue;
+            }
+
+            controller = getControllerManager().findController(ed->entity);
+            if (controller) {
+                BotNoticeEvent(controller, originator, origin, iType, r2, iAreaNum);
+            }
         }
-
-        if (dist2 > r2) {
-            continue;
+    } else {
+        for (i = 1; i <= controllers.NumObjects(); i++) {
+            BotNoticeEvent(controllers.ObjectAt(i), originator, origin, iType, r2, iAreaNum);
         }
-
-        if (iAreaNum != ent->edict->r.areanum && !gi.AreasConnected(iAreaNum, ent->edict->r.areanum)) {
-            continue;
-        }
-
-        controller->NoticeEvent(origin, iType, originator, dist2, r2);
     }
 }
 
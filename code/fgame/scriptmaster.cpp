@@ -33,6 +33,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "worldspawn.h"
 #include "scriptcompiler.h"
 #include "scriptexception.h"
+#include "scriptprofiler.h"
 
 #ifdef WIN32
 #    include <direct.h>
@@ -734,6 +735,14 @@ ScriptThread *ScriptMaster::CreateScriptThread(ScriptClass *scriptClass, str lab
 
 ScriptMaster::ScriptMaster()
 {
+    m_iNumPrecompiled = 0;
+
+    m_bBudgetActive        = false;
+    m_bPreempted           = false;
+    m_iBudgetChecks        = 0;
+    m_iPreemptResumeTime   = 0;
+    m_iNumFramesOverBudget = 0;
+    m_iNumPreempted        = 0;
 }
 
 void ScriptMaster::Reset(qboolean samemap)
@@ -770,11 +779,16 @@ void ScriptMaster::Reset(qboolean samemap)
 
 void ScriptMaster::ExecuteRunning(void)
 {
-    int i;
-    int startTime;
-    int startMs;
-    str fileName;
-    str sourcePosString;
+    int            i;
+    int            startTime;
+    int            startMs;
+    str            fileName;
+    str            sourcePosString;
+    long long      budget;
+    int            numPreempted;
+    GameScript    *scr;
+    unsigned char *codePos;
+    qctime_t       runStart;
 
     if (stackCount) {
         return;
@@ -788,6 +802,15 @@ void ScriptMaster::ExecuteRunning(void)
     cmdCount  = 0;
     startTime = level.svsTime;
 
+    budget          = (long long)(g_scriptbudget->value * 1000);
+    numPreempted    = m_iNumPreempted;
+    m_bBudgetActive = budget > 0;
+
+    if (m_bBudgetActive) {
+        m_BudgetEnd          = qcclock_t::now() + std::chrono::microseconds(budget);
+        m_iPreemptResumeTime = level.inttime + level.intframetime;
+    }
+
     try {
         while ((m_CurrentThread = (ScriptThread *)timerList.GetNextElement(i))) {
             if (g_timescripts->integer) {
@@ -796,11 +819,30 @@ void ScriptMaster::ExecuteRunning(void)
                 startMs         = gi.Milliseconds();
             }
 
+            if (m_bBudgetActive) {
+                // every thread gets a few loops before it can be preempted
+                m_iBudgetChecks = 0;
+                m_bPreempted    = false;
+
+                scr      = m_CurrentThread->m_ScriptVM->GetScript();
+                codePos  = m_CurrentThread->m_ScriptVM->m_CodePos;
+                runStart = qcclock_t::now();
+            }
+
             level.setTime(level.svsStartTime + i);
 
             m_CurrentThread->m_ScriptVM->m_ThreadState = THREAD_RUNNING;
             m_CurrentThread->m_ScriptVM->Execute();
 
+            if (m_bBudgetActive) {
+                AddThreadTime(
+                    scr,
+                    codePos,
+                    std::chrono::duration_cast<std::chrono::microseconds>(qcclock_t::now() - runStart).count(),
+                    budget
+                );
+            }
+
             if (g_timescripts->integer) {
                 str string;
 
@@ -815,13 +857,77 @@ void ScriptMaster::ExecuteRunning(void)
             }
         }
     } catch (const ScriptException& e) {
+        m_bBudgetActive = false;
         gi.Error(ERR_DROP, "%s", e.string.c_str());
     }
 
+    m_bBudgetActive = false;
+
+    if (m_iNumPreempted != numPreempted) {
+        m_iNumFramesOverBudget++;
+    }
+
     level.setTime(startTime);
     level.m_LoopProtection = true;
 }
 
+/*
+====================
+CheckBudget
+
+Preempts the thread resumed by ExecuteRunning once the execution budget of the frame is spent,
+it continues on the next frame as if it waited for a frame
+====================
+*/
+void ScriptMaster::CheckBudget(ScriptThread *thread)
+{
+    if (++m_iBudgetChecks < BUDGET_CHECK_INTERVAL) {
+        return;
+    }
+
+    m_iBudgetChecks = 0;
+
+    if (qcclock_t::now() < m_BudgetEnd) {
+        return;
+    }
+
+    thread->StartTiming(m_iPreemptResumeTime);
+    thread->m_ScriptVM->Suspend();
+
+    m_bPreempted = true;
+    m_iNumPreempted++;
+}
+
+void ScriptMaster::AddThreadTime(GameScript *scr, unsigned char *codePos, long long time, long long budget)
+{
+    scriptThreadTime_t *threadTime;
+    const_str           label;
+    str                 name;
+
+    // finding the label is slow, only the threads that matter are recorded
+    if (!m_bPreempted && time * 10 < budget) {
+        return;
+    }
+
+    name  = scr->Filename();
+    label = scr->m_State.NearestLabel(codePos);
+    if (label) {
+        name += "::" + GetString(label);
+    }
+
+    threadTime = &m_ThreadTimes[name];
+    threadTime->numRuns++;
+    threadTime->totalTime += time;
+
+    if (m_bPreempted) {
+        threadTime->numPreempted++;
+    }
+
+    if (time > threadTime->maxTime) {
+        threadTime->maxTime = time;
+    }
+}
+
 void ScriptMaster::SetTime(int time)
 {
     timerList.SetTime(time);
@@ -857,6 +963,13 @@ void ScriptMaster::CloseGameScript(void)
     }
 
     m_GameScripts.clear();
+
+    // queued again by the next map, from its rotation
+    m_PrecompileQueue.FreeObjectList();
+    m_iNumPrecompiled = 0;
+
+    // the code positions of the freed scripts will be reused
+    scriptProfiler.ClearThreadNames();
 }
 
 GameScript *ScriptMaster::GetGameScriptInternal(str& filename)
@@ -884,18 +997,16 @@ GameScript *ScriptMaster::GetGameScriptInternal(str& filename)
 
     m_GameScripts[StringDict.addKeyIndex(filename)] = scr;
 
-    if (GetCompiledScript(scr)) {
-        scr->m_Filename = Director.AddString(filename);
-        return scr;
-    }
-
     sourceLength = gi.FS_ReadFile(filename.c_str(), &sourceBuffer, true);
 
     if (sourceLength == -1) {
         throw ScriptException("Can't find '%s'\n", filename.c_str());
     }
 
-    scr->Load(sourceBuffer, sourceLength);
+    if (!GetCompiledScript(scr, sourceBuffer, sourceLength)) {
+        scr->Load(sourceBuffer, sourceLength);
+        SaveCompiledScript(scr, sourceBuffer, sourceLength);
+    }
 
     gi.FS_FreeFile(sourceBuffer);
 
@@ -906,6 +1017,140 @@ GameScript *ScriptMaster::GetGameScriptInternal(str& filename)
     return scr;
 }
 
+//
+// Scripts of the maps that will be played next are compiled a few milliseconds per frame
+// and stored in the script cache, so loading these maps only has to read the compiled programs.
+// The compiler and the string dictionary are not thread-safe, and compiled programs reference
+// strings that don't survive a map change, so this is done on the main thread through the cache.
+//
+void ScriptMaster::QueuePrecompile(const char *filename)
+{
+    char filepath[MAX_QPATH];
+    str  name;
+
+    if (strlen(filename) >= MAX_QPATH) {
+        return;
+    }
+
+    Q_strncpyz(filepath, filename, sizeof(filepath));
+    gi.FS_CanonicalFilename(filepath);
+    name = filepath;
+
+    if (!m_PrecompileQueue.ObjectInList(name)) {
+        m_PrecompileQueue.AddObject(name);
+    }
+}
+
+void ScriptMaster::QueuePrecompileMap(const char *mapname)
+{
+    str    level_name = mapname;
+    size_t i;
+
+    // same names as the scripts loaded by Level::SetMap
+    for (i = 0; i < level_name.length(); i++) {
+        if (level_name[i] == '$' || level_name[i] == '.') {
+            level_name[i] = 0;
+            break;
+        }
+    }
+
+    QueuePrecompile(("maps/" + level_name + ".scr").c_str());
+    QueuePrecompile(("maps/" + level_name + "_precache.scr").c_str());
+}
+
+void ScriptMaster::QueueScriptReferences(const char *sourceBuffer, int sourceLength)
+{
+    const char *p;
+    const char *start;
+    const char *end;
+    char        filename[MAX_QPATH];
+
+    // scripts executed or waited for by this one, found from their file names
+    for (p = sourceBuffer; p + 4 <= sourceBuffer + sourceLength; p++) {
+        if (Q_stricmpn(p, ".scr", 4)) {
+            continue;
+        }
+
+        end = p + 4;
+        if (end < sourceBuffer + sourceLength && (isalnum((unsigned char)*end) || *end == '_')) {
+            continue;
+        }
+
+        for (start = p; start > sourceBuffer; start--) {
+            const char c = start[-1];
+
+            if (!isalnum((unsigned char)c) && c != '_' && c != '-' && c != '/' && c != '\\' && c != '.') {
+                break;
+            }
+        }
+
+        if (start == p || end - start >= MAX_QPATH) {
+            continue;
+        }
+
+        Q_strncpyz(filename, start, end - start + 1);
+        QueuePrecompile(filename);
+    }
+}
+
+void ScriptMaster::PrecompileScript(const str& filename)
+{
+    void       *sourceBuffer = NULL;
+    int         sourceLength;
+    const_str   name;
+    GameScript *scr;
+
+    name = StringDict.findKeyIndex(filename);
+    if (name && m_GameScripts.find(name)) {
+        // already loaded by this map
+        return;
+    }
+
+    sourceLength = gi.FS_ReadFile(filename.c_str(), &sourceBuffer, true);
+    if (sourceLength == -1) {
+        return;
+    }
+
+    QueueScriptReferences((const char *)sourceBuffer, sourceLength);
+
+    if (!HasCompiledScript(sourceBuffer, sourceLength)) {
+        // compiled apart from the scripts of the current map
+        scr = new GameScript(filename);
+
+        try {
+            scr->Load(sourceBuffer, sourceLength);
+            SaveCompiledScript(scr, sourceBuffer, sourceLength);
+        } catch (const ScriptException& e) {
+            gi.DPrintf("Failed to precompile '%s': %s\n", filename.c_str(), e.string.c_str());
+        }
+
+        delete scr;
+    }
+
+    gi.FS_FreeFile(sourceBuffer);
+}
+
+void ScriptMaster::PrecompileScripts(int msec)
+{
+    int startTime;
+
+    if (msec <= 0 || !g_scriptcache->integer) {
+        return;
+    }
+
+    startTime = gi.Milliseconds();
+
+    // at least one script is compiled per frame, however long it takes
+    while (m_iNumPrecompiled < m_PrecompileQueue.NumObjects()) {
+        m_iNumPrecompiled++;
+        PrecompileScript(m_PrecompileQueue.ObjectAt(m_iNumPrecompiled));
+
+        if (gi.Milliseconds() - startTime >= msec) {
+            break;
+        }
+    }
+}
+
 GameScript *ScriptMaster::GetGameScript(const_str filename, qboolean recompile)
 {
     return GetGameScript(Director.GetString(filename), recompile);
@@ -1301,3 +1546,89 @@ void ScriptMaster::PrintThread(int iThreadNum)
 
     gi.Printf(status.c_str());
 }
+
+void ScriptMaster::PrintStringStats(bool reset)
+{
+    size_t lookups = StringDict.NumLookups();
+
+    gi.Printf(
+        "%u strings, %zu bytes, %zu lookups: %zu found from the pointer (%.1f%%)\n",
+        StringDict.size(),
+        StringDict.MemoryUsage(),
+        lookups,
+        StringDict.NumRecentHits(),
+        lookups ? StringDict.NumRecentHits() * 100.0 / lookups : 0.0
+    );
+
+    if (reset) {
+        StringDict.ResetStats();
+    }
+}
+
+typedef struct {
+    const str                *name;
+    const scriptThreadTime_t *time;
+} threadTimeEntry_t;
+
+static int CompareThreadTimes(const void *elem1, const void *elem2)
+{
+    const long long time1 = ((const threadTimeEntry_t *)elem1)->time->totalTime;
+    const long long time2 = ((const threadTimeEntry_t *)elem2)->time->totalTime;
+
+    if (time1 > time2) {
+        return -1;
+    } else if (time1 < time2) {
+        return 1;
+    }
+
+    return 0;
+}
+
+void ScriptMaster::PrintThreadTimes(bool reset)
+{
+    con_map_enum<str, scriptThreadTime_t> en(m_ThreadTimes);
+    threadTimeEntry_t                    *entries;
+    int                                   numEntries;
+    int                                   i;
+
+    gi.Printf(
+        "%d threads preempted in %d frames over the budget of %.2f ms\n",
+        m_iNumPreempted,
+        m_iNumFramesOverBudget,
+        g_scriptbudget->value
+    );
+
+    entries    = new threadTimeEntry_t[m_ThreadTimes.size() + 1];
+    numEntries = 0;
+
+    for (const str *name = en.NextKey(); name; name = en.NextKey()) {
+        entries[numEntries].name = name;
+        entries[numEntries].time = en.CurrentValue();
+        numEntries++;
+    }
+
+    qsort(entries, numEntries, sizeof(threadTimeEntry_t), CompareThreadTimes);
+
+    if (numEntries) {
+        gi.Printf(" total ms    max ms   runs preempted  label\n");
+    }
+
+    for (i = 0; i < numEntries && i < 10; i++) {
+        gi.Printf(
+            "%9.2f %9.2f %6d %9d  %s\n",
+            entries[i].time->totalTime / 1000.0,
+            entries[i].time->maxTime / 1000.0,
+            entries[i].time->numRuns,
+            entries[i].time->numPreempted,
+            entries[i].name->c_str()
+        );
+    }
+
+    delete[] entries;
+
+    if (reset) {
+        m_ThreadTimes.clear();
+        m_iNumFramesOverBudget = 0;
+        m_iNumPreempted        = 0;
+    }
+}
@@ -28,16 +28,28 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../corepp/listener.h"
 #include "scriptvm.h"
 #include "../corepp/con_timer.h"
+#include "../corepp/con_strpool.h"
 
 #define MAX_COMMANDS       20
 #define MAX_EXECUTION_TIME 3000
 
+// backward jumps and function calls of a resumed thread between two checks of the execution budget
+#define BUDGET_CHECK_INTERVAL 16
+
 void Showmenu(const str& name, qboolean bForce);
 void Hidemenu(const str& name, qboolean bForce);
 
 #define MAX_VAR_STACK 1024
 #define MAX_FASTEVENT 10
 
+// Time taken by the threads of a label that were preempted or used a tenth of the execution budget
+typedef struct {
+    int       numRuns;
+    int       numPreempted;
+    long long totalTime; // microseconds
+    long long maxTime;
+} scriptThreadTime_t;
+
 class ScriptMaster : public Listener
 {
     friend class ScriptThread;
@@ -66,10 +78,25 @@ public:
     con_map<const_str, GameScript *> m_GameScripts; // compiled gamescripts
 
     // Miscellaneous
-    Container<str>         m_menus;    // Script menus
-    con_timer              timerList;  // waiting threads list
-    con_arrayset<str, str> StringDict; // const strings (improve performance)
-    int                    iPaused;    // num times paused
+    Container<str> m_menus;    // Script menus
+    con_timer      timerList;  // waiting threads list
+    con_strpool    StringDict; // const strings (improve performance)
+    int            iPaused;    // num times paused
+
+    // Scripts compiled to the script cache in the background
+    Container<str> m_PrecompileQueue;   // scripts of the next maps, each queued once until the scripts are freed
+    int            m_iNumPrecompiled;   // scripts of the queue already processed
+
+    // Execution budget of the threads resumed each frame (g_scriptbudget)
+    bool         m_bBudgetActive;      // set while ExecuteRunning resumes the threads
+    bool         m_bPreempted;         // the thread being resumed was preempted
+    unsigned int m_iBudgetChecks;      // backward jumps and calls since the last check of the clock
+    qctime_t     m_BudgetEnd;          // threads are preempted after this time
+    int          m_iPreemptResumeTime; // preempted threads are resumed on the next frame
+
+    con_map<str, scriptThreadTime_t> m_ThreadTimes; // by "file::label"
+    int                              m_iNumFramesOverBudget;
+    int                              m_iNumPreempted;
 
 protected:
     static const char *ConstStrings[];
@@ -78,10 +105,13 @@ protected:
     void        InitConstStrings(void);
     void        CloseGameScript();
     GameScript *GetGameScriptInternal(str& filename);
+    void        PrecompileScript(const str& filename);
+    void        QueueScriptReferences(const char *sourceBuffer, int sourceLength);
     void        ExecuteRunning();
     void        Cache(Event *ev);
     void        RegisterAliasAndCache(Event *ev);
     void        RegisterAlias(Event *ev);
+    void        AddThreadTime(GameScript *scr, unsigned char *codePos, long long time, long long budget);
 
 public:
     CLASS_PROTOTYPE(ScriptMaster);
@@ -114,10 +144,15 @@ public:
     GameScript *GetScript(const_str filename, qboolean recompile = false);
     GameScript *GetScript(str filename, qboolean recompile = false);
 
+    void QueuePrecompile(const char *filename);
+    void QueuePrecompileMap(const char *mapname);
+    void PrecompileScripts(int msec);
+
     void SetTime(int time);
 
     void      AddTiming(ScriptThread *thread, int time);
     void      RemoveTiming(ScriptThread *thread);
+    void      CheckBudget(ScriptThread *thread);
     const_str AddString(const char *s);
     const_str AddString(str& s);
     const_str GetString(const char *s);
@@ -138,6 +173,8 @@ public:
 
     void PrintStatus(void);
     void PrintThread(int iThreadNum);
+    void PrintStringStats(bool reset = false);
+    void PrintThreadTimes(bool reset = false);
 };
 
 extern Event EV_RegisterAlias;
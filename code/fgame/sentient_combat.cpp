@@ -242,21 +242,11 @@ bool Sentient::CanSee(Entity *ent, float fov, float vision_distance, bool bNoEnt
     }
 
     if (ent->IsSubclassOfSentient()) {
-        return G_SightTrace(
-            EyePosition(),
-            vec_zero,
-            vec_zero,
-            static_cast<Sentient *>(ent)->EyePosition(),
-            this,
-            ent,
-            mask,
-            qfalse,
-            "Sentient::CanSee 1"
+        return G_CachedSightTrace(
+            EyePosition(), static_cast<Sentient *>(ent)->EyePosition(), this, ent, mask, "Sentient::CanSee 1"
         );
     } else {
-        return G_SightTrace(
-            EyePosition(), vec_zero, vec_zero, ent->centroid, this, ent, mask, qfalse, "Sentient::CanSee 2"
-        );
+        return G_CachedSightTrace(EyePosition(), ent->centroid, this, ent, mask, "Sentient::CanSee 2");
     }
 }
 
@@ -281,7 +271,7 @@ bool Sentient::CanSee(const Vector& org, float fov, float vision_distance, bool
         mask = MASK_CANSEE;
     }
 
-    return G_SightTrace(EyePosition(), vec_zero, vec_zero, org, this, NULL, mask, qfalse, "Sentient::CanSee");
+    return G_CachedSightTrace(EyePosition(), org, this, NULL, mask, "Sentient::CanSee");
 }
 
 Vector Sentient::GunPosition(void)
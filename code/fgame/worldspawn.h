@@ -65,18 +65,11 @@ class con_set_Entry<const_str, ConSimple>
     friend con_set<const_str, ConSimple>;
     friend con_set_enum<const_str, ConSimple>;
 
-private:
-    con_set_Entry *next;
-
 public:
     const_str key;
     ConSimple value;
 
 public:
-    void *operator new(size_t size) { return con_set<const_str, ConSimple>::NewEntry(size); }
-
-    void operator delete(void *ptr) { con_set<const_str, ConSimple>::DeleteEntry(ptr); }
-
     void Archive(Archiver& arc)
     {
         int num;
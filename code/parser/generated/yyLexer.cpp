@@ -0,0 +1,2076 @@
+// Generated by pyflex from lex_source.txt, do not edit
+/*
+* ===========================================================================
+* Copyright (C) 2025 the OpenMoHAA team
+* 
+* This file is part of OpenMoHAA source code.
+* 
+* OpenMoHAA source code is free software; you can redistribute it
+* and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of the License,
+* or (at your option) any later version.
+* 
+* OpenMoHAA source code is distributed in the hope that it will be
+* useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+* 
+* You should have received a copy of the GNU General Public License
+* along with OpenMoHAA source code; if not, write to the Free Software
+* Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+* ===========================================================================
+*
+*
+* yyLexer.*: FLEX Lexical grammar for MoHScript.
+*/
+
+// Included before the scanner macros, parsetree.h has members named yytext and yylineno
+#include "scriptcompiler.h"
+#include "./yyParser.hpp"
+
+#include <stdio.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+
+#define YY_EXTRA_TYPE yyparsedata *
+#define YY_NULL 0
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno yyg->yylineno_r
+#define yylval yyg->yylval_r
+#define yylloc yyg->yylloc_r
+#define BEGIN yyg->yy_start = 1 + 2 *
+#define YY_START (((yyg->yy_start) - 1) / 2)
+#define YYSTATE YY_START
+#define yymore() (yyg->yy_more_flag = 1)
+#define YY_MORE_ADJ yyg->yy_more_len
+#define YY_RESTORE_YY_MORE_OFFSET
+#define unput(c) yyunput(c, yyscanner)
+#define YY_END_OF_BUFFER_CHAR 0
+
+#ifdef __cplusplus
+extern "C" int yywrap(yyscan_t yyscanner);
+#else
+extern int yywrap(yyscan_t yyscanner);
+#endif
+
+#define YY_NUM_CLASSES 65
+#define YY_DEFAULT_RULE 106
+static const unsigned short yy_ec[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 6, 7, 8, 9, 10, 7,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 21,
+    22, 23, 24, 25, 7, 26, 27, 27, 27, 27, 27, 27, 27, 28, 27, 27, 29, 27, 30, 27,
+    27, 27, 27, 27, 27, 31, 27, 27, 27, 27, 27, 32, 33, 34, 35, 36, 7, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 27, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    27, 59, 60, 61, 62, 63, 64, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+static const short yy_nxt[18265] = {
+    6, 7, 8, 6, 9, 10, 11, 6, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 30, 30, 30, 31, 30, 32, 33, 34, 35, 30, 30, 36, 37,
+    38, 39, 40, 41, 30, 42, 30, 43, 44, 30, 45, 46, 30, 30, 47, 48, 30, 30, 49, 30,
+    30, 50, 51, 52, 53, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 55, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 54, 54, 54,
+    54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 54, 54, 54, 54, 56, 56, 57, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 58, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    59, 60, 61, 59, 62, 59, 63, 59, 64, 59, 59, 59, 59, 59, 59, 59, 59, 65, 59, 64,
+    59, 59, 59, 59, 59, 59, 64, 64, 64, 64, 64, 64, 59, 64, 59, 59, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 66, 64, 64, 64, 64, 64,
+    64, 59, 59, 59, 59, 67, 68, 69, 67, 68, 67, 67, 67, 67, 67, 67, 70, 70, 67, 67,
+    70, 67, 67, 67, 67, 70, 70, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 70, 67, 70,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 70, 67, 70, 67, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 71, -1, 72, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 73, -1, 73, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 73, -1, 73, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 74, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 75, 75, -1, 75, -1,
+    75, 76, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 77, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    -1, -1, -1, -1, -1, -1, -1, -1, 78, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 79, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    80, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 81, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 82, -1, -1, -1, -1, 83, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 84, -1, -1, -1, -1, -1, -1, -1, -1, 85, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 86, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 87, -1, -1, -1,
+    -1, -1, -1, 88, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 89, 89, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 90, -1, 90, -1, -1, -1, -1, -1, 89, 89, 89, 89, 89, 89, 89, -1, -1, -1,
+    -1, 89, 89, 89, 89, 89, 91, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 92, -1, -1, -1, -1, 93, -1, -1, -1, -1, 94, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 89, 89, -1, -1, -1, -1, -1, -1, -1, -1, -1, 90, -1, 95, -1, -1, -1, -1, -1,
+    89, 96, 96, 96, 96, 96, 96, -1, -1, -1, -1, 96, 96, 96, 96, 96, 97, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    98, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 99, 100, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 101, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 102, 103, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 105, 104, 104, 106, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 107, -1, 107, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 108, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 109, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 110, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 111, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    112, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 113, 104, 114, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 115, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 116, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 117, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 118, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 119, 104, 104, 104,
+    104, 104, 104, 104, 104, 120, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 121, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 122, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 123, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 124, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 125, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 126, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 127, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 128, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 129, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 130, -1, -1, -1, -1, -1,
+    -1, 130, 130, 130, 130, 130, 130, -1, -1, -1, -1, -1, 130, 130, 130, 130, 130, 130, 130, 130,
+    130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 131, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 132, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 133, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 134, 134, -1, 134, -1,
+    134, 135, 134, 136, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 136, 134, 134, 134, 134, 134,
+    134, 136, 136, 136, 136, 136, 136, 134, 137, 134, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 134, 134, 134, 134,
+    -1, -1, -1, -1, -1, -1, 138, -1, 138, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138,
+    -1, -1, -1, -1, -1, -1, 138, 138, 138, 138, 138, 138, -1, 138, -1, -1, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, -1, -1, -1, -1, 139, -1, -1, -1, -1, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 140, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, -1, -1, -1, -1, -1, -1, 138, -1, 138, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, -1, -1, -1, -1, -1, -1, 138, 138, 138, 138,
+    138, 138, -1, 138, -1, -1, 138, 138, 138, 138, 138, 138, 138, 138, 138, 141, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, -1, -1, -1, -1, 142, -1, -1, 142, -1,
+    142, 142, 142, 142, 142, 142, -1, -1, 142, 142, -1, 142, 142, 142, 142, -1, -1, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, -1, 142, -1, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, -1, 142, -1, 142,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 143, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 144, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 145, -1, -1, -1,
+    -1, -1, -1, 146, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 73, -1, 73, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 75, 75, -1, 75, -1,
+    75, 76, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 77, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    -1, -1, -1, -1, -1, -1, 147, 147, -1, -1, -1, -1, -1, -1, -1, -1, -1, 147, -1, 147,
+    -1, -1, -1, -1, -1, 147, 147, 147, 147, 147, 147, 147, -1, -1, -1, -1, 147, 147, 147, 147,
+    147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+    147, -1, -1, -1, -1, 148, 148, -1, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, -1, -1, -1, -1, -1, -1, -1, -1, 78, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 89, 89, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 90, -1, 90, -1, -1, -1, -1, -1, 89, 89, 89, 89, 89,
+    89, 89, -1, -1, -1, -1, 89, 89, 89, 89, 89, 91, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 149, -1, 150, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 151, 151, -1, 151, -1, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 89, 89, -1, -1, -1, -1, -1, -1, -1, -1, -1, 90, -1, 95, -1, -1, -1, -1, -1,
+    89, 96, 96, 96, 96, 96, 96, -1, -1, -1, -1, 96, 96, 96, 96, 96, 97, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 149,
+    -1, 150, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 152, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 153, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 154, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 155,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, 107, -1, 107,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 156, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 157, 158, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 159, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 160,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 161, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 162, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 163, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 164, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 165, 104, 166, 104, 104, 104, 167, 104, 168,
+    104, 104, 104, 104, 169, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 170, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 171,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 172, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 173,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 174, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 175, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 176, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 177, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    178, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 130, -1, -1, -1, -1, -1, -1, 130, 130, 130, 130,
+    130, 130, -1, -1, -1, -1, -1, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+    130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 132, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 133, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 139, -1, -1, -1, -1, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 140, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 134, 134, -1, 134, -1, 134, 179, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 180, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, -1, -1, -1, -1, -1,
+    -1, 138, -1, 138, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, -1, -1, -1, -1, -1,
+    -1, 138, 138, 138, 138, 138, 138, -1, 138, -1, -1, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, -1, -1, -1, -1,
+    134, 134, -1, 134, -1, 134, 135, 134, 136, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 136,
+    134, 134, 134, 134, 134, 134, 136, 136, 136, 136, 136, 136, 134, 137, 134, 134, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 134, 134, 134, 134, 181, 181, -1, 181, 181, 181, 182, 181, 182, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 182, 181, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 182, 181, 182, 181,
+    181, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    182, 182, 182, 182, 182, 182, 181, 181, 181, 181, -1, -1, -1, -1, -1, -1, 138, -1, 138, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, -1, -1, -1, -1, -1, -1, 138, 138, 138, 138,
+    138, 138, -1, 138, -1, -1, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    139, -1, -1, -1, -1, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 140,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, -1, -1, -1, -1, -1, -1, 138, -1, 138, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 138, -1, -1, -1, -1, -1, -1, 138, 138, 138, 138, 138, 138, -1, 138, -1,
+    -1, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 183, -1, -1, -1, -1, 142, -1, -1, 142, -1, 142, 142, 142, 142, 142,
+    142, -1, -1, 142, 142, -1, 142, 142, 142, 142, -1, -1, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, -1, 142, -1, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, -1, 142, -1, 142, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    75, 75, -1, 75, -1, 75, 76, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 77, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 184, -1, 184, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 185, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 184, -1, 184, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 185, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 151, 151, -1, 151, -1,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 186, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 187, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 188, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 189, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 190, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 191, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 192, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 193, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 194, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 195, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 196, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 197, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 198, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 199, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    200, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 201, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 202, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 203, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 204, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 205, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 206, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 207, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 208, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    181, 181, -1, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 134, 134, -1, 134, -1, 134, 179, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 180, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, -1, 134, -1, 134, 135, 134, 136, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 136, 134, 134, 134, 134, 134, 134, 136, 136, 136, 136,
+    136, 136, 134, 137, 134, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 134, 134, 134, 134, -1, -1, -1, -1, -1,
+    -1, 138, -1, 138, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, -1, -1, -1, -1, -1,
+    -1, 138, 138, 138, 138, 138, 138, -1, 138, -1, -1, 138, 138, 138, 138, 138, 209, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 149,
+    -1, 150, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 210, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 211, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 212, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 213, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 214, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 215, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 216, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 217, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 218, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 219, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 220, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 221, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 222, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 223, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 224, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 225, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 226, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 227, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 138, -1, 138, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 138, -1, -1, -1, -1, -1, -1, 138, 138, 138, 138, 138, 138, -1, 138, -1,
+    -1, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+    138, 138, 138, 138, 138, 138, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 228, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 229, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 230, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 231, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 232, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 233, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 234, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 235, 104, 104, 104, 104, 104, 104, 104, 236, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 237, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 238, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 239, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 240, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 241, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 242, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 243, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 244, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 245, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 246, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 247, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 248, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 249, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 250, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 251, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 252, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 253, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 254, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 255, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 256, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 257, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 258, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 259, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 260, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 261, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 262, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 263, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 264, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 265, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 266, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 267,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 268, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 269, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 270, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 271, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 272, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 273, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 274, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 275, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 276, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 277, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 278, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 279, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 280, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104, -1, -1, -1, -1, -1,
+    -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 104,
+    -1, -1, -1, -1, -1, -1, 104, 104, 104, 104, 104, 104, -1, -1, -1, -1, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, -1, -1, -1, -1,
+};
+static const short yy_accept[281] = {
+    0, 0, 0, 0, 0, 99, 102, 95, 94, 94, 80, 102, 79, 70, 46, 31, 32, 66, 59, 83,
+    62, 82, 68, 96, 36, 38, 50, 35, 52, 16, 102, 102, 33, 102, 34, 45, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 29, 44, 30, 81, 106, 104, 4, 3, 4, 13,
+    12, 12, 12, 11, 11, 13, 11, 99, 100, 100, 101, 0, 58, 94, 47, 0, 15, 0, 79, 71,
+    43, 76, 5, 67, 61, 60, 62, 65, 63, 97, 98, 97, 1, 7, 69, 96, 97, 97, 37, 72,
+    54, 39, 56, 74, 103, 103, 103, 6, 77, 103, 103, 103, 21, 103, 103, 103, 103, 103, 17, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 78, 42, 104, 2, 0, 0, 0, 10, 11, 11, 11, 9,
+    0, 11, 99, 61, 62, 65, 64, 14, 0, 0, 0, 7, 73, 75, 85, 103, 103, 103, 103, 103,
+    103, 103, 20, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 86, 103, 10,
+    0, 0, 11, 11, 98, 0, 84, 103, 89, 103, 103, 18, 103, 103, 22, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 26, 28, 103, 103, 8, 90, 87, 103, 103, 103, 23, 103, 103, 103, 103,
+    103, 24, 25, 103, 103, 27, 103, 19, 103, 103, 103, 103, 103, 51, 103, 103, 103, 103, 103, 88,
+    103, 103, 103, 40, 103, 103, 103, 103, 103, 103, 103, 91, 93, 93, 103, 103, 103, 103, 103, 103,
+    103, 53, 103, 103, 103, 103, 92, 92, 103, 103, 48, 41, 103, 103, 55, 103, 103, 103, 103, 49,
+    57,
+};
+static const short yy_start_state[6] = {
+    0, 1, 2, 3, 4, 5,
+};
+static const short yy_head9_nxt[768] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1,
+};
+static const short yy_head9_accept[3] = {
+    0, 0, 1,
+};
+static const short yy_trail9_nxt[768] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+};
+static const short yy_trail9_accept[3] = {
+    0, 1, 0,
+};
+
+// user code
+void fprintf2(FILE * f, const char *format, ...)
+{
+    va_list va;
+    char    buffer[4200];
+
+    va_start(va, format);
+    vsprintf(buffer, format, va);
+    va_end(va);
+
+    gi.Printf(buffer);
+}
+
+#define fprintf fprintf2
+
+static void yyllocset(yyparsedata *parsedata, YYLTYPE *loc, size_t leng, uint32_t off)
+{
+    parsedata->success_pos = parsedata->out_pos - leng + off;
+    loc->sourcePos         = parsedata->success_pos;
+    parsedata->pos         = parsedata->success_pos;
+}
+
+static void yyreducepos(yyparsedata *parsedata, uint32_t off)
+{
+    parsedata->out_pos -= off;
+}
+
+#define YYLEX(n)                                 \
+    {                                            \
+        yyllocset(yyextra, yylloc, yyleng, 0);   \
+        yyextra->prev_yylex = n;                 \
+        return n;                                \
+    }
+#define YYLEXOFF(n, off)                         \
+    {                                            \
+        yyllocset(yyextra, yylloc, yyleng, off); \
+        yyextra->prev_yylex = n;                 \
+        return n;                                \
+    }
+
+#define YY_USER_ACTION                                 \
+    {                                                  \
+        yyextra->out_pos += yyleng - YY_MORE_ADJ;      \
+        yylloc->sourcePos = yyextra->out_pos;          \
+        yyextra->pos      = yyextra->out_pos;          \
+    }
+
+// the scanner is not always available where flex raises errors
+#define YY_FATAL_ERROR(n) yylexerror(n, "")
+
+static void yylexerror(const char *msg, const char *text)
+{
+    gi.DPrintf("%s\n%s", msg, text);
+    assert(0);
+}
+
+static void TextEscapeValue(yyparsedata *parsedata, YYSTYPE *lval, const char *str, size_t len)
+{
+    char *to = parsetree_malloc(*parsedata, len + 1);
+
+    lval->s.val.stringValue = to;
+
+    while (len) {
+        if (*str == '\\') {
+            if (len == 1) {
+                break;
+            }
+
+            if (str[1] == 'n') {
+                *to = '\n';
+                to++;
+            } else if (str[1] == 't') {
+                *to = '\t';
+                to++;
+            } else if (str[1] == '"') {
+                *to = '\"';
+                to++;
+            } else {
+                *to = str[1];
+                to++;
+            }
+
+            len -= 2;
+            str += 2;
+        } else {
+            *to = *str;
+            to++;
+            len--;
+            str++;
+        }
+    }
+
+    *to = 0;
+}
+
+static void TextValue(yyparsedata *parsedata, YYSTYPE *lval, const char *str, size_t len)
+{
+    char *s = parsetree_malloc(*parsedata, len + 1);
+    strncpy(s, str, len);
+    s[len]                  = 0;
+    lval->s.val.stringValue = s;
+}
+
+static bool UseField(yyparsedata *parsedata)
+{
+    return parsedata->prev_yylex == TOKEN_PERIOD || parsedata->prev_yylex == TOKEN_DOLLAR;
+}
+
+#define YY_INPUT(buf, result, max_size)  \
+    {                                    \
+        char c;                          \
+        int  n;                          \
+                                         \
+        c = '*';                         \
+        for (n = 0; n < max_size; n++) { \
+            c = *yyextra->in_ptr++;      \
+            if (!c || c == '\n') {       \
+                break;                   \
+            }                            \
+                                         \
+            buf[n] = c;                  \
+        }                                \
+                                         \
+        if (c == '\n') {                 \
+            buf[n++] = c;                \
+        } else if (!c) {                 \
+            yyextra->in_ptr--;           \
+        }                                \
+                                         \
+        result = n;                      \
+    }
+
+
+#define INITIAL 0
+#define SCRIPT 1
+#define C_COMMENT 2
+#define C_LINE_COMMENT 3
+#define VARIABLES 4
+#define IDENTIFIER 5
+
+struct yyguts_t {
+    YY_EXTRA_TYPE yyextra_r;
+    char         *yy_buf;
+    int           yy_buf_size;
+    int           yy_n_chars;
+    int           yy_c_buf_p;
+    char          yy_hold_char;
+    int           yy_eof_pending;
+    int           yy_init;
+    int           yy_start;
+    int           yy_more_flag;
+    int           yy_more_len;
+    int           yytext_pos;
+    char         *yytext_r;
+    int           yyleng_r;
+    int           yylineno_r;
+    YYSTYPE      *yylval_r;
+    YYLTYPE      *yylloc_r;
+};
+
+#ifndef YY_READ_BUF_SIZE
+#define YY_READ_BUF_SIZE 8192
+#endif
+#ifndef YY_FATAL_ERROR
+#define YY_FATAL_ERROR(msg) (fputs(msg, stderr), exit(2))
+#endif
+#ifndef YY_INPUT
+#error YY_INPUT must be defined
+#endif
+#ifndef yyterminate
+#define yyterminate() return YY_NULL
+#endif
+#ifndef YY_DECL
+#define YY_DECL int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+
+
+static void yy_ensure_size(struct yyguts_t *yyg, int size)
+{
+    if (size + 2 > yyg->yy_buf_size) {
+        int newsize = yyg->yy_buf_size ? yyg->yy_buf_size : 16384;
+        while (size + 2 > newsize) {
+            newsize *= 2;
+        }
+        yyg->yy_buf = (char *)realloc(yyg->yy_buf, newsize);
+        if (!yyg->yy_buf) {
+            YY_FATAL_ERROR("out of dynamic memory in yy_ensure_size()");
+        }
+        yyg->yy_buf_size = newsize;
+    }
+}
+
+// Moves the text from keep to the front of the buffer and reads more input.
+// Returns the number of characters read; *shift is how far the text moved back.
+static int yy_read_more(struct yyguts_t *yyg, int keep, int *shift)
+{
+    int n;
+    int result;
+
+    n = yyg->yy_n_chars - keep;
+    if (keep > 0) {
+        memmove(yyg->yy_buf, yyg->yy_buf + keep, n);
+    }
+    *shift          = keep;
+    yyg->yy_n_chars = n;
+
+    yy_ensure_size(yyg, n + YY_READ_BUF_SIZE);
+    result = 0;
+    {
+        char *yy_read_buf = yyg->yy_buf + n;
+        YY_INPUT(yy_read_buf, result, YY_READ_BUF_SIZE);
+    }
+    yyg->yy_n_chars += result;
+    yyg->yy_buf[yyg->yy_n_chars]     = YY_END_OF_BUFFER_CHAR;
+    yyg->yy_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
+    return result;
+}
+
+static void yyunput(int c, yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    int              cp  = yyg->yy_c_buf_p;
+
+    yyg->yy_buf[cp] = yyg->yy_hold_char;
+    if (cp == 0) {
+        yy_ensure_size(yyg, yyg->yy_n_chars + 1);
+        memmove(yyg->yy_buf + 1, yyg->yy_buf, yyg->yy_n_chars + 1);
+        yyg->yy_n_chars++;
+        yyg->yytext_pos++;
+        cp++;
+    }
+
+    yyg->yy_buf[--cp] = (char)c;
+    if (c == '\n') {
+        --yylineno;
+    }
+
+    yyg->yytext_r     = yyg->yy_buf + yyg->yytext_pos;
+    yyg->yy_hold_char = yyg->yy_buf[cp];
+    yyg->yy_c_buf_p   = cp;
+}
+
+static int yy_run_dfa(const short *nxt, const short *acc, const char *text, int len)
+{
+    int s = 0;
+    int i;
+    for (i = 0; i < len; i++) {
+        s = nxt[s * 256 + (unsigned char)text[i]];
+        if (s < 0) {
+            return 0;
+        }
+    }
+    return acc[s];
+}
+
+static int yy_trailing_head(int rule, const char *text, int len)
+{
+    int k;
+    switch (rule) {
+    case 9:
+        for (k = len; k >= 0; k--) {
+            if (yy_run_dfa(yy_head9_nxt, yy_head9_accept, text, k)
+                && yy_run_dfa(yy_trail9_nxt, yy_trail9_accept, text + k, len - k)) {
+                return k;
+            }
+        }
+        break;
+    }
+    return len;
+}
+
+YY_DECL
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    int              yy_current_state;
+    int              yy_cp, yy_bp;
+    int              yy_act;
+    int              yy_last_pos;
+    int              yy_shift;
+    int              yyl;
+
+    yylval = yylval_param;
+    yylloc = yylloc_param;
+
+    if (!yyg->yy_init) {
+        yyg->yy_init = 1;
+        if (!yyg->yy_start) {
+            yyg->yy_start = 1;
+        }
+        yy_ensure_size(yyg, YY_READ_BUF_SIZE);
+        yyg->yy_buf[0] = YY_END_OF_BUFFER_CHAR;
+    }
+
+    for (;;) {
+        yyg->yy_more_len = 0;
+        if (yyg->yy_more_flag) {
+            yyg->yy_more_len  = yyg->yy_c_buf_p - yyg->yytext_pos;
+            yyg->yy_more_flag = 0;
+        }
+        yy_cp              = yyg->yy_c_buf_p;
+        yyg->yy_buf[yy_cp] = yyg->yy_hold_char;
+        yy_bp              = yy_cp;
+
+        yy_current_state = yy_start_state[YY_START];
+        yy_act           = yy_accept[yy_current_state];
+        yy_last_pos      = yy_cp;
+
+        for (;;) {
+            int next;
+
+            if (yy_cp >= yyg->yy_n_chars) {
+                if (yyg->yy_eof_pending) {
+                    break;
+                }
+                if (yy_read_more(yyg, yy_bp - yyg->yy_more_len, &yy_shift)) {
+                    yy_bp -= yy_shift;
+                    yy_cp -= yy_shift;
+                    yy_last_pos -= yy_shift;
+                    yyg->yy_c_buf_p -= yy_shift;
+                    continue;
+                }
+                yy_bp -= yy_shift;
+                yy_cp -= yy_shift;
+                yy_last_pos -= yy_shift;
+                yyg->yy_c_buf_p -= yy_shift;
+                if (yy_cp > yy_bp) {
+                    yyg->yy_eof_pending = 1;
+                }
+                break;
+            }
+
+            next = yy_nxt[yy_current_state * YY_NUM_CLASSES + yy_ec[(unsigned char)yyg->yy_buf[yy_cp]]];
+            if (next < 0) {
+                break;
+            }
+
+            yy_current_state = next;
+            yy_cp++;
+            if (yy_accept[yy_current_state]) {
+                yy_act      = yy_accept[yy_current_state];
+                yy_last_pos = yy_cp;
+            }
+        }
+
+        if (yy_cp == yy_bp) {
+            // end of the input: the buffer is flushed
+            yyg->yy_n_chars     = 0;
+            yyg->yy_c_buf_p     = 0;
+            yyg->yy_hold_char   = YY_END_OF_BUFFER_CHAR;
+            yyg->yy_eof_pending = 0;
+            yyg->yytext_pos     = 0;
+            yyg->yy_buf[0]      = YY_END_OF_BUFFER_CHAR;
+            if (yywrap(yyscanner)) {
+                yyterminate();
+            }
+            continue;
+        }
+
+        yy_cp = yy_last_pos;
+        if (yy_act != YY_DEFAULT_RULE) {
+            switch (yy_act) {
+            case 9:
+                yy_cp = yy_bp + yy_trailing_head(yy_act, yyg->yy_buf + yy_bp, yy_cp - yy_bp);
+                break;
+            }
+        }
+
+        yyg->yytext_pos = yy_bp - yyg->yy_more_len;
+        yyg->yytext_r   = yyg->yy_buf + yyg->yytext_pos;
+        yyleng          = yy_cp - yyg->yytext_pos;
+        yyg->yy_hold_char  = yyg->yy_buf[yy_cp];
+        yyg->yy_buf[yy_cp] = 0;
+        yyg->yy_c_buf_p    = yy_cp;
+
+        for (yyl = yyg->yy_more_len; yyl < yyleng; ++yyl) {
+            if (yytext[yyl] == '\n') {
+                yylineno++;
+            }
+        }
+
+        switch (yy_act) {
+        case 1:
+            YY_RULE_SETUP
+            { BEGIN(C_COMMENT); }
+            YY_BREAK
+        case 2:
+            YY_RULE_SETUP
+            { BEGIN(INITIAL); }
+            YY_BREAK
+        case 3:
+            YY_RULE_SETUP
+            { ; }
+            YY_BREAK
+        case 4:
+            YY_RULE_SETUP
+            { ; }
+            YY_BREAK
+        case 5:
+            YY_RULE_SETUP
+            { yyextra->compiler->CompileError(yyextra->pos - yyleng, "'*/' found outside of comment"); }
+            YY_BREAK
+        case 6:
+            YY_RULE_SETUP
+            { ; }
+            YY_BREAK
+        case 7:
+            YY_RULE_SETUP
+            { if (yyextra->prev_yylex != TOKEN_EOL) YYLEX(TOKEN_EOL); }
+            YY_BREAK
+        case 8:
+            YY_RULE_SETUP
+            { BEGIN(INITIAL); YYLEX(TOKEN_SIZE); }
+            YY_BREAK
+        case 9:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_PERIOD); }
+            YY_BREAK
+        case 10:
+            YY_RULE_SETUP
+            { BEGIN(INITIAL); TextEscapeValue(yyextra, yylval, yytext + 1, strlen( yytext ) - 2 ); YYLEX(TOKEN_STRING); }
+            YY_BREAK
+        case 11:
+            YY_RULE_SETUP
+            {
+                                                TextEscapeValue(yyextra, yylval, yytext, strlen(yytext));
+                                                YYLEX(TOKEN_IDENTIFIER);
+                                            }
+            YY_BREAK
+        case 12:
+            YY_RULE_SETUP
+            {
+                                                BEGIN(INITIAL);
+                                                unput(yytext[yyleng - 1]);
+                                                yyreducepos(yyextra, 1);
+                                            }
+            YY_BREAK
+        case 13:
+            YY_RULE_SETUP
+            {
+                                                BEGIN(INITIAL);
+                                                unput(yytext[yyleng - 1]);
+                                                yyreducepos(yyextra, 1);
+                                            }
+            YY_BREAK
+        case 14:
+            YY_RULE_SETUP
+            {
+                                    BEGIN(IDENTIFIER);
+                                    yymore();
+                                }
+            YY_BREAK
+        case 15:
+            YY_RULE_SETUP
+            { TextEscapeValue(yyextra, yylval, yytext + 1, yyleng - 2); YYLEX(TOKEN_STRING); }
+            YY_BREAK
+        case 16:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_TERNARY); }
+            YY_BREAK
+        case 17:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_IF); }
+            YY_BREAK
+        case 18:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_ELSE); }
+            YY_BREAK
+        case 19:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_WHILE); }
+            YY_BREAK
+        case 20:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_FOR); }
+            YY_BREAK
+        case 21:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_DO); }
+            YY_BREAK
+        case 22:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_game); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 23:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_group); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 24:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_level); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 25:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_local); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 26:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_parm); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 27:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_owner); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 28:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); yylval->s.val = node1_(method_self); YYLEX(TOKEN_LISTENER); }
+            YY_BREAK
+        case 29:
+            YY_RULE_SETUP
+            { yyextra->braces_count++; YYLEX(TOKEN_LEFT_BRACES); }
+            YY_BREAK
+        case 30:
+            YY_RULE_SETUP
+            { yyextra->braces_count--; YYLEX(TOKEN_RIGHT_BRACES); }
+            YY_BREAK
+        case 31:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LEFT_BRACKET); }
+            YY_BREAK
+        case 32:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); YYLEX(TOKEN_RIGHT_BRACKET); }
+            YY_BREAK
+        case 33:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LEFT_SQUARE_BRACKET); }
+            YY_BREAK
+        case 34:
+            YY_RULE_SETUP
+            { BEGIN(VARIABLES); YYLEX(TOKEN_RIGHT_SQUARE_BRACKET); }
+            YY_BREAK
+        case 35:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_ASSIGNMENT); }
+            YY_BREAK
+        case 36:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_COLON); }
+            YY_BREAK
+        case 37:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_DOUBLE_COLON); }
+            YY_BREAK
+        case 38:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SEMICOLON); }
+            YY_BREAK
+        case 39:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_EQUALITY); }
+            YY_BREAK
+        case 40:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_EQUALITY); }
+            YY_BREAK
+        case 41:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_EQUALITY); }
+            YY_BREAK
+        case 42:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LOGICAL_OR); }
+            YY_BREAK
+        case 43:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LOGICAL_AND); }
+            YY_BREAK
+        case 44:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_BITWISE_OR); }
+            YY_BREAK
+        case 45:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_BITWISE_EXCL_OR); }
+            YY_BREAK
+        case 46:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_BITWISE_AND); }
+            YY_BREAK
+        case 47:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_INEQUALITY); }
+            YY_BREAK
+        case 48:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_INEQUALITY); }
+            YY_BREAK
+        case 49:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_INEQUALITY); }
+            YY_BREAK
+        case 50:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LESS_THAN); }
+            YY_BREAK
+        case 51:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LESS_THAN); }
+            YY_BREAK
+        case 52:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_GREATER_THAN); }
+            YY_BREAK
+        case 53:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_GREATER_THAN); }
+            YY_BREAK
+        case 54:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LESS_THAN_OR_EQUAL); }
+            YY_BREAK
+        case 55:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_LESS_THAN_OR_EQUAL); }
+            YY_BREAK
+        case 56:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_GREATER_THAN_OR_EQUAL); }
+            YY_BREAK
+        case 57:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_GREATER_THAN_OR_EQUAL); }
+            YY_BREAK
+        case 58:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_NEG); }
+            YY_BREAK
+        case 59:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_PLUS); }
+            YY_BREAK
+        case 60:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_PLUS_EQUALS); }
+            YY_BREAK
+        case 61:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_INCREMENT); }
+            YY_BREAK
+        case 62:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MINUS); }
+            YY_BREAK
+        case 63:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MINUS_EQUALS); }
+            YY_BREAK
+        case 64:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MINUS_EQUALS); }
+            YY_BREAK
+        case 65:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_DECREMENT); }
+            YY_BREAK
+        case 66:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MULTIPLY); }
+            YY_BREAK
+        case 67:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MULTIPLY_EQUALS); }
+            YY_BREAK
+        case 68:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_DIVIDE); }
+            YY_BREAK
+        case 69:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_DIVIDE_EQUALS); }
+            YY_BREAK
+        case 70:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MODULUS); }
+            YY_BREAK
+        case 71:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MODULUS_EQUALS); }
+            YY_BREAK
+        case 72:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SHIFT_LEFT); }
+            YY_BREAK
+        case 73:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SHIFT_LEFT_EQUALS); }
+            YY_BREAK
+        case 74:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SHIFT_RIGHT); }
+            YY_BREAK
+        case 75:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SHIFT_RIGHT_EQUALS); }
+            YY_BREAK
+        case 76:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_AND_EQUALS); }
+            YY_BREAK
+        case 77:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_EXCL_OR_EQUALS); }
+            YY_BREAK
+        case 78:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_OR_EQUALS); }
+            YY_BREAK
+        case 79:
+            YY_RULE_SETUP
+            { BEGIN( VARIABLES ); YYLEX(TOKEN_DOLLAR); }
+            YY_BREAK
+        case 80:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_NOT); }
+            YY_BREAK
+        case 81:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_COMPLEMENT); }
+            YY_BREAK
+        case 82:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_PERIOD); }
+            YY_BREAK
+        case 83:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_COMMA); }
+            YY_BREAK
+        case 84:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_NULL); }
+            YY_BREAK
+        case 85:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_NIL); }
+            YY_BREAK
+        case 86:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_TRY); }
+            YY_BREAK
+        case 87:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_CATCH); }
+            YY_BREAK
+        case 88:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_SWITCH); }
+            YY_BREAK
+        case 89:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_CASE); }
+            YY_BREAK
+        case 90:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_BREAK); }
+            YY_BREAK
+        case 91:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_CONTINUE); }
+            YY_BREAK
+        case 92:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_MAKEARRAY); }
+            YY_BREAK
+        case 93:
+            YY_RULE_SETUP
+            { YYLEX(TOKEN_ENDARRAY); }
+            YY_BREAK
+        case 94:
+            YY_RULE_SETUP
+            { if (yyextra->prev_yylex != TOKEN_EOL) YYLEX(TOKEN_EOL); }
+            YY_BREAK
+        case 95:
+            YY_RULE_SETUP
+            { ; }
+            YY_BREAK
+        case 96:
+            YY_RULE_SETUP
+            {
+                                            char* p = nullptr;
+                                            yylval->s.val.intValue = std::strtol(yytext, &p, 10);
+                                            YYLEX(TOKEN_INTEGER);
+                                        }
+            YY_BREAK
+        case 97:
+            YY_RULE_SETUP
+            {
+                                            BEGIN(IDENTIFIER);
+                                            yymore();
+                                        }
+            YY_BREAK
+        case 98:
+            YY_RULE_SETUP
+            {
+                                            char* p = nullptr;
+                                            yylval->s.val.floatValue = std::strtof(yytext, &p);
+                                            YYLEX(TOKEN_FLOAT);
+                                        }
+            YY_BREAK
+        case 99:
+            YY_RULE_SETUP
+            {
+                                            BEGIN(INITIAL);
+                                            TextEscapeValue(yyextra, yylval, yytext, yyleng);
+                                            YYLEX(TOKEN_IDENTIFIER);
+                                        }
+            YY_BREAK
+        case 100:
+            YY_RULE_SETUP
+            {
+                                            BEGIN(INITIAL);
+                                            unput(yytext[yyleng - 1]);
+                                            yyreducepos(yyextra, 1);
+                                            TextEscapeValue(yyextra, yylval, yytext, yyleng - 1);
+                                            YYLEXOFF(TOKEN_IDENTIFIER, 1);
+                                        }
+            YY_BREAK
+        case 101:
+            YY_RULE_SETUP
+            {
+                                            BEGIN(INITIAL);
+                                            unput(yytext[yyleng - 1]);
+                                            yyreducepos(yyextra, 1);
+                                            TextEscapeValue(yyextra, yylval, yytext, yyleng - 1);
+                                            YYLEXOFF(TOKEN_IDENTIFIER, 1);
+                                        }
+            YY_BREAK
+        case 102:
+            YY_RULE_SETUP
+            {
+                                    BEGIN(IDENTIFIER);
+                                    yymore();
+                                }
+            YY_BREAK
+        case 103:
+            YY_RULE_SETUP
+            {
+                                    BEGIN(IDENTIFIER);
+                                    yymore();
+                                }
+            YY_BREAK
+        case 104:
+            YY_RULE_SETUP
+            { BEGIN(INITIAL); }
+            YY_BREAK
+        case 105:
+            YY_RULE_SETUP
+            { yylexerror("bad token:\n", yytext); }
+            YY_BREAK
+        case YY_DEFAULT_RULE:
+            YY_RULE_SETUP
+            YY_FATAL_ERROR("flex scanner jammed");
+            YY_BREAK
+
+#undef fprintf
+
+        }
+    }
+}
+
+int yylex_init_extra(YY_EXTRA_TYPE yy_user_defined, yyscan_t *ptr_yy_globals)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)calloc(1, sizeof(struct yyguts_t));
+
+    if (!yyg) {
+        *ptr_yy_globals = NULL;
+        return 1;
+    }
+
+    yyg->yyextra_r   = yy_user_defined;
+    yyg->yylineno_r  = 1;
+    *ptr_yy_globals  = yyg;
+    return 0;
+}
+
+int yylex_init(yyscan_t *ptr_yy_globals)
+{
+    return yylex_init_extra(NULL, ptr_yy_globals);
+}
+
+int yylex_destroy(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+
+    free(yyg->yy_buf);
+    free(yyg);
+    return 0;
+}
+
+YY_EXTRA_TYPE yyget_extra(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    return yyextra;
+}
+
+void yyset_extra(YY_EXTRA_TYPE user_defined, yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    yyextra              = user_defined;
+}
+
+int yyget_lineno(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    return yylineno;
+}
+
+void yyset_lineno(int line_number, yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    yylineno             = line_number;
+}
+
+char *yyget_text(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    return yytext;
+}
+
+int yyget_leng(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+    return yyleng;
+}
+
+// user code
+
+//
+// Implements yywrap to always append a newline to the source
+//
+int yywrap(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg       = (struct yyguts_t *)yyscanner;
+    yyparsedata     *parsedata = yyextra;
+
+    if (parsedata->parseStage == PS_TYPE) {
+        parsedata->parseStage  = PS_BODY;
+        parsedata->in_ptr      = parsedata->start_ptr;
+        parsedata->out_pos     = 0;
+        parsedata->success_pos = 0;
+        return 0;
+    }
+
+    if (parsedata->parseStage == PS_BODY) {
+        if (YY_START == C_COMMENT) {
+            parsedata->compiler->CompileError(parsedata->success_pos, "unexpected end of file found in comment");
+            return 1;
+        }
+
+        parsedata->parseStage = PS_BODY_END;
+        parsedata->in_ptr     = "\n";
+        return 0;
+    }
+
+    return 1;
+}
+
+void yy_init_script(yyscan_t yyscanner)
+{
+    struct yyguts_t *yyg = (struct yyguts_t *)yyscanner;
+
+    BEGIN(SCRIPT);
+}
+
@@ -0,0 +1,57 @@
+// Generated by pyflex from lex_source.txt, do not edit
+#ifndef yyHEADER_H
+#define yyHEADER_H 1
+/*
+* ===========================================================================
+* Copyright (C) 2025 the OpenMoHAA team
+* 
+* This file is part of OpenMoHAA source code.
+* 
+* OpenMoHAA source code is free software; you can redistribute it
+* and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation; either version 2 of the License,
+* or (at your option) any later version.
+* 
+* OpenMoHAA source code is distributed in the hope that it will be
+* useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+* 
+* You should have received a copy of the GNU General Public License
+* along with OpenMoHAA source code; if not, write to the Free Software
+* Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+* ===========================================================================
+*
+*
+* yyLexer.*: FLEX Lexical grammar for MoHScript.
+*/
+
+// Included before the scanner macros, parsetree.h has members named yytext and yylineno
+#include "scriptcompiler.h"
+#include "./yyParser.hpp"
+
+#include <stdio.h>
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE yyparsedata *
+#endif
+int yylex_init(yyscan_t *scanner);
+int yylex_init_extra(YY_EXTRA_TYPE user_defined, yyscan_t *scanner);
+int yylex_destroy(yyscan_t yyscanner);
+YY_EXTRA_TYPE yyget_extra(yyscan_t yyscanner);
+void yyset_extra(YY_EXTRA_TYPE user_defined, yyscan_t yyscanner);
+int yyget_lineno(yyscan_t yyscanner);
+void yyset_lineno(int line_number, yyscan_t yyscanner);
+char *yyget_text(yyscan_t yyscanner);
+int yyget_leng(yyscan_t yyscanner);
+#ifdef __cplusplus
+extern "C" int yywrap(yyscan_t yyscanner);
+#else
+extern int yywrap(yyscan_t yyscanner);
+#endif
+extern int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner);
+#undef YY_EXTRA_TYPE
+#endif
@@ -24,13 +24,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "parsetree.h"
 #include "../fgame/gamecvars.h"
-#include "../corepp/mem_tempalloc.h"
 
-MEM_TempAlloc parsetree_allocator;
-yyparsedata   parsedata;
-sval_u        node_none = {0};
+sval_u node_none = {0};
 
-char *str_replace(char *orig, const char *rep, const char *with)
+char *str_replace(yyparsedata& parsedata, char *orig, const char *rep, const char *with)
 {
     char  *result;    // the return string
     char  *ins;       // the next insert point
@@ -62,7 +59,7 @@ char *str_replace(char *orig, const char *rep, const char *with)
     //    tmp points to the end of the result string
     //    ins points to the next occurrence of rep in orig
     //    orig points to the remainder of orig after "end of rep"
-    tmp = result = (char *)parsetree_allocator.Alloc(strlen(orig) + (len_with - len_rep) * count + 1);
+    tmp = result = parsetree_malloc(parsedata, strlen(orig) + (len_with - len_rep) * count + 1);
 
     if (!result) {
         return NULL;
@@ -79,21 +76,29 @@ char *str_replace(char *orig, const char *rep, const char *with)
     return result;
 }
 
-void parsetree_freeall()
+void parsetree_freeall(yyparsedata& parsedata)
 {
-    parsetree_allocator.FreeAll();
+    parsedata.allocator.FreeAll();
 
     if (g_showopcodes->integer) {
         gi.DPrintf("%d bytes freed\n", parsedata.total_length);
     }
 }
 
-void parsetree_init()
+void parsetree_init(yyparsedata& parsedata)
 {
     parsedata.total_length = 0;
+    parsedata.braces_count = 0;
+    parsedata.line_count   = 0;
+    parsedata.pos          = 0;
+    parsedata.val          = sval_t();
+    parsedata.prev_yylex   = 0;
+    parsedata.out_pos      = 0;
+    parsedata.success_pos  = 0;
+    parsedata.exc          = yyexception();
 }
 
-size_t parsetree_length()
+size_t parsetree_length(const yyparsedata& parsedata)
 {
     return parsedata.total_length;
 }
@@ -129,13 +134,11 @@ char* parsetree_string(const char* string)
 }
 #endif
 
-extern size_t yyleng;
-extern size_t prev_yyleng;
-
-char *parsetree_malloc(size_t s)
+char *parsetree_malloc(yyparsedata& parsedata, size_t s)
 {
     parsedata.total_length += s;
-    return (char *)parsetree_allocator.Alloc(s);
+    // nodes and strings share blocks
+    return (char *)parsedata.allocator.Alloc(s, alignof(sval_u));
 }
 
 sval_u append_lists(sval_u val1, sval_u val2)
@@ -146,11 +149,11 @@ sval_u append_lists(sval_u val1, sval_u val2)
     return val1;
 }
 
-sval_u append_node(sval_u val1, sval_u val2)
+sval_u append_node(yyparsedata& parsedata, sval_u val1, sval_u val2)
 {
     sval_u *node;
 
-    node = (sval_u *)parsetree_malloc(sizeof(sval_t[2]));
+    node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[2]));
 
     node[1].node = NULL;
     node[0]      = val2;
@@ -161,11 +164,11 @@ sval_u append_node(sval_u val1, sval_u val2)
     return val1;
 }
 
-sval_u prepend_node(sval_u val1, sval_u val2)
+sval_u prepend_node(yyparsedata& parsedata, sval_u val1, sval_u val2)
 {
     sval_u *node;
 
-    node = (sval_u *)parsetree_malloc(sizeof(sval_t[2]));
+    node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[2]));
 
     node[0] = val1;
     node[1] = val2;
@@ -175,17 +178,17 @@ sval_u prepend_node(sval_u val1, sval_u val2)
     return val2;
 }
 
-sval_u linked_list_end(sval_u val)
+sval_u linked_list_end(yyparsedata& parsedata, sval_u val)
 {
     sval_u *node;
     sval_u  end;
 
-    node = (sval_u *)parsetree_malloc(sizeof(sval_t[2]));
+    node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[2]));
 
     node[0]      = val;
     node[1].node = NULL;
 
-    end.node = (sval_u *)parsetree_malloc(sizeof(sval_t[2]));
+    end.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[2]));
 
     end.node[0].node = node;
     end.node[1].node = node;
@@ -229,7 +232,7 @@ sval_u node_string(char *text)
     return val;
 }
 
-sval_u node0(int type)
+sval_u node0(yyparsedata& parsedata, int type)
 {
     sval_u val;
 
@@ -237,7 +240,7 @@ sval_u node0(int type)
         // memory optimization
         val.node = &node_none;
     } else {
-        val.node = (sval_u *)parsetree_malloc(sizeof(sval_u));
+        val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_u));
 
         val.node[0].node = NULL;
         val.node[0].type = type;
@@ -246,11 +249,11 @@ sval_u node0(int type)
     return val;
 }
 
-sval_u node1(int type, sval_u val1)
+sval_u node1(yyparsedata& parsedata, int type, sval_u val1)
 {
     sval_u val;
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_u[2]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_u[2]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -258,13 +261,13 @@ sval_u node1(int type, sval_u val1)
     return val;
 }
 
-sval_u node2(int type, sval_u val1, sval_u val2)
+sval_u node2(yyparsedata& parsedata, int type, sval_u val1, sval_u val2)
 {
     sval_u val;
 
     assert(type != ENUM_NOP);
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_t[3]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[3]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -273,13 +276,13 @@ sval_u node2(int type, sval_u val1, sval_u val2)
     return val;
 }
 
-sval_u node3(int type, sval_u val1, sval_u val2, sval_u val3)
+sval_u node3(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3)
 {
     sval_u val;
 
     assert(type != ENUM_NOP);
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_t[4]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[4]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -289,13 +292,13 @@ sval_u node3(int type, sval_u val1, sval_u val2, sval_u val3)
     return val;
 }
 
-sval_u node4(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4)
+sval_u node4(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4)
 {
     sval_u val;
 
     assert(type != ENUM_NOP);
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_t[5]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[5]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -306,13 +309,13 @@ sval_u node4(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4)
     return val;
 }
 
-sval_u node5(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5)
+sval_u node5(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5)
 {
     sval_u val;
 
     assert(type != ENUM_NOP);
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_t[6]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[6]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -324,13 +327,14 @@ sval_u node5(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_
     return val;
 }
 
-sval_u node6(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5, sval_u val6)
+sval_u
+node6(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5, sval_u val6)
 {
     sval_u val;
 
     assert(type != ENUM_NOP);
 
-    val.node = (sval_u *)parsetree_malloc(sizeof(sval_t[7]));
+    val.node = (sval_u *)parsetree_malloc(parsedata, sizeof(sval_t[7]));
 
     val.node[0].type = type;
     val.node[1]      = val1;
@@ -343,11 +347,11 @@ sval_u node6(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_
     return val;
 }
 
-sval_u node_listener(sval_u val1, sval_u val2)
+sval_u node_listener(yyparsedata& parsedata, sval_u val1, sval_u val2)
 {
     if (!str::icmp(val1.stringValue, "self")) {
-        return node2(ENUM_listener, node1_(method_self), val2);
+        return node2(parsedata, ENUM_listener, node1_(method_self), val2);
     } else {
-        return node2(ENUM_string, val1, val2);
+        return node2(parsedata, ENUM_string, val1, val2);
     }
 }
@@ -25,13 +25,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #pragma once
 
 #include "../corepp/str.h"
+#include "../corepp/mem_tempalloc.h"
 
 #if defined(GAME_DLL)
-#    define showopcodes g_showopcodes
+#    define showopcodes    g_showopcodes
+#    define scriptoptimize g_scriptoptimize
 #elif defined(CGAME_DLL)
-#    define showopcodes cg_showopcodes
+#    define showopcodes    cg_showopcodes
+#    define scriptoptimize cg_scriptoptimize
 #else
-#    define showopcodes g_showopcodes
+#    define showopcodes    g_showopcodes
+#    define scriptoptimize g_scriptoptimize
 #endif
 
 typedef enum {
@@ -113,30 +117,33 @@ enum {
     method_array,
 };
 
-void   parsetree_freeall();
-void   parsetree_init();
-size_t parsetree_length();
-char  *parsetree_malloc(size_t s);
+struct yyparsedata;
+
+void   parsetree_freeall(yyparsedata& parsedata);
+void   parsetree_init(yyparsedata& parsedata);
+size_t parsetree_length(const yyparsedata& parsedata);
+char  *parsetree_malloc(yyparsedata& parsedata, size_t s);
 
 sval_u append_lists(sval_u val1, sval_u val2);
-sval_u append_node(sval_u val1, sval_u val2);
-sval_u prepend_node(sval_u val1, sval_u val2);
+sval_u append_node(yyparsedata& parsedata, sval_u val1, sval_u val2);
+sval_u prepend_node(yyparsedata& parsedata, sval_u val1, sval_u val2);
 
-sval_u linked_list_end(sval_u val);
+sval_u linked_list_end(yyparsedata& parsedata, sval_u val);
 
 sval_u node1_(int val1);
 sval_u node1b(int val1);
 sval_u node_pos(unsigned int pos);
 sval_u node_string(char *text);
 
-sval_u node0(int type);
-sval_u node1(int type, sval_u val1);
-sval_u node2(int type, sval_u val1, sval_u val2);
-sval_u node3(int type, sval_u val1, sval_u val2, sval_u val3);
-sval_u node4(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4);
-sval_u node5(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5);
-sval_u node6(int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5, sval_u val6);
-sval_u node_listener(sval_u val1, sval_u val2);
+sval_u node0(yyparsedata& parsedata, int type);
+sval_u node1(yyparsedata& parsedata, int type, sval_u val1);
+sval_u node2(yyparsedata& parsedata, int type, sval_u val1, sval_u val2);
+sval_u node3(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3);
+sval_u node4(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4);
+sval_u node5(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5);
+sval_u
+node6(yyparsedata& parsedata, int type, sval_u val1, sval_u val2, sval_u val3, sval_u val4, sval_u val5, sval_u val6);
+sval_u node_listener(yyparsedata& parsedata, sval_u val1, sval_u val2);
 
 typedef struct parse_pos_s {
     int sourcePos;
@@ -154,6 +161,13 @@ struct yyexception {
     yyexception() { yylineno = 0; }
 };
 
+// Parse nodes are allocated in blocks of this size
+#define PARSETREE_BLOCK_SIZE 65536
+
+//
+// State of one parse, shared by the scanner and the parser so that
+// several scripts can be parsed at the same time by different compilers
+//
 struct yyparsedata {
     size_t total_length;
 
@@ -162,18 +176,41 @@ struct yyparsedata {
     unsigned int pos;
     sval_t       val;
 
-    char             *sourceBuffer;
-    class GameScript *gameScript;
+    // scanner state
+    const char  *start_ptr;
+    const char  *in_ptr;
+    parseStage_e parseStage;
+    int          prev_yylex;
+    int          out_pos;
+    int          success_pos;
+
+    char                 *sourceBuffer;
+    class GameScript     *gameScript;
+    class ScriptCompiler *compiler;
+
+    // parse nodes and strings, all released by parsetree_freeall
+    MEM_TempAlloc allocator;
 
     yyexception exc;
 
     yyparsedata()
+        : allocator(PARSETREE_BLOCK_SIZE)
     {
         total_length = 0, braces_count = 0, line_count = 0, pos = 0;
         val          = sval_t();
+        start_ptr    = NULL;
+        in_ptr       = NULL;
+        parseStage   = PS_TYPE;
+        prev_yylex   = 0;
+        out_pos      = 0;
+        success_pos  = 0;
         sourceBuffer = NULL;
         gameScript   = NULL;
+        compiler     = NULL;
     }
-};
 
-extern yyparsedata parsedata;
+private:
+    // the allocator owns the parse tree
+    yyparsedata(const yyparsedata&);
+    yyparsedata& operator=(const yyparsedata&);
+};
@@ -756,6 +756,37 @@ void FS_Remove_HomeData( const char *homePath ) {
 			fs_gamedir, homePath ) );
 }
 
+/*
+===========
+FS_Rename_HomeData
+
+Replaces the destination file if it exists
+===========
+*/
+qboolean FS_Rename_HomeData( const char *from, const char *to ) {
+	char			*from_ospath, *to_ospath;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+
+	from_ospath = FS_BuildOSPath( fs_homedatapath->string, fs_gamedir, from );
+	to_ospath = FS_BuildOSPath( fs_homedatapath->string, fs_gamedir, to );
+
+	if ( fs_debug->integer ) {
+		Com_Printf( "FS_Rename_HomeData: %s --> %s\n", from_ospath, to_ospath );
+	}
+
+	FS_CheckFilenameIsMutable( to_ospath, __func__ );
+
+#ifdef _WIN32
+	// rename() doesn't replace an existing file on windows
+	remove( to_ospath );
+#endif
+
+	return rename( from_ospath, to_ospath ) == 0 ? qtrue : qfalse;
+}
+
 /*
 ================
 FS_FileInPathExists
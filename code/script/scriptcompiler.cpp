@@ -34,6 +34,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "../parser/parsetree.h"
 #include "../parser/generated/yyParser.hpp"
 #include "../parser/generated/yyLexer.h"
+#include "../fgame/crc32.h"
 
 ScriptCompiler Compiler;
 int            ScriptCompiler::current_label;
@@ -68,6 +69,7 @@ void ScriptCompiler::Reset()
 
     bCanBreak    = false;
     bCanContinue = false;
+    bOptimize    = false;
 
     prev_opcode_pos = 0;
 }
@@ -77,6 +79,11 @@ unsigned char ScriptCompiler::PrevOpcode()
     return prev_opcodes[prev_opcode_pos].opcode;
 }
 
+unsigned char ScriptCompiler::PrevPrevOpcode()
+{
+    return prev_opcodes[(prev_opcode_pos + 99) % 100].opcode;
+}
+
 signed char ScriptCompiler::PrevVarStackOffset()
 {
     return prev_opcodes[prev_opcode_pos].VarStackOffset;
@@ -158,6 +165,17 @@ void ScriptCompiler::AddJumpToLocation(unsigned char *pos)
     ClearPrevOpcode();
 }
 
+// A condition that is always true is removed with the conditional jump following it
+bool ScriptCompiler::AbsorbTrueCondition()
+{
+    if (!bOptimize || PrevOpcode() != OP_BOOL_STORE_TRUE) {
+        return false;
+    }
+
+    AbsorbPrevOpcode();
+    return true;
+}
+
 bool ScriptCompiler::BuiltinReadVariable(unsigned int sourcePos, int type, int eventnum)
 {
     ClassDef *c;
@@ -276,6 +294,15 @@ void ScriptCompiler::EmitAssignmentStatement(sval_t lhs, unsigned int sourcePos)
         || (eventnum && BuiltinWriteVariable(sourcePos, listener_val.node[1].intValue, eventnum))) {
         EmitValue(listener_val);
         EmitOpcode(OP_LOAD_FIELD_VAR, sourcePos);
+    } else if (bOptimize && listener_val.node[1].intValue == method_local
+               && (PrevOpcode() == OP_UN_INC || PrevOpcode() == OP_UN_DEC) && PrevPrevOpcode() == OP_STORE_LOCAL_VAR
+               && GetOpcodeValue<unsigned int>(1 + sizeof(unsigned int), sizeof(unsigned int)) == index) {
+        // local.var++ and local.var--
+        const int opcode = PrevOpcode() == OP_UN_INC ? OP_UN_INC_LOCAL_VAR : OP_UN_DEC_LOCAL_VAR;
+
+        AbsorbPrevOpcode();
+        AbsorbPrevOpcode();
+        EmitOpcode(opcode, sourcePos);
     } else {
         EmitOpcode(OP_LOAD_GAME_VAR + listener_val.node[1].intValue, sourcePos);
     }
@@ -288,6 +315,9 @@ void ScriptCompiler::EmitBoolJumpFalse(unsigned int sourcePos)
     if (PrevOpcode() == OP_UN_CAST_BOOLEAN) {
         AbsorbPrevOpcode();
         EmitOpcode(OP_VAR_JUMP_FALSE4, sourcePos);
+    } else if (bOptimize && PrevOpcode() == OP_BOOL_STORE_FALSE) {
+        AbsorbPrevOpcode();
+        EmitOpcode(OP_JUMP4, sourcePos);
     } else {
         EmitOpcode(OP_BOOL_JUMP_FALSE4, sourcePos);
     }
@@ -298,6 +328,9 @@ void ScriptCompiler::EmitBoolJumpTrue(unsigned int sourcePos)
     if (PrevOpcode() == OP_UN_CAST_BOOLEAN) {
         AbsorbPrevOpcode();
         EmitOpcode(OP_VAR_JUMP_TRUE4, sourcePos);
+    } else if (bOptimize && PrevOpcode() == OP_BOOL_STORE_TRUE) {
+        AbsorbPrevOpcode();
+        EmitOpcode(OP_JUMP4, sourcePos);
     } else {
         EmitOpcode(OP_BOOL_JUMP_TRUE4, sourcePos);
     }
@@ -440,11 +473,14 @@ void ScriptCompiler::EmitDoWhileJump(sval_t while_stmt, sval_t while_expr, unsig
     EmitValue(while_expr);
     EmitVarToBool(sourcePos);
 
-    label2 = EmitNot(sourcePos);
+    unsigned char *jmp = NULL;
 
-    unsigned char *jmp = code_pos;
+    if (!AbsorbTrueCondition()) {
+        label2 = EmitNot(sourcePos);
+        jmp    = code_pos;
 
-    code_pos += sizeof(unsigned int);
+        code_pos += sizeof(unsigned int);
+    }
 
     if (showopcodes->integer) {
         glbs.DPrintf("JUMP_BACK4 <LABEL%d>\n", label1);
@@ -454,11 +490,13 @@ void ScriptCompiler::EmitDoWhileJump(sval_t while_stmt, sval_t while_expr, unsig
 
     ClearPrevOpcode();
 
-    if (showopcodes->integer) {
-        glbs.DPrintf("<LABEL%d>:\n", label2);
-    }
+    if (jmp) {
+        if (showopcodes->integer) {
+            glbs.DPrintf("<LABEL%d>:\n", label2);
+        }
 
-    AddJumpLocation(jmp);
+        AddJumpLocation(jmp);
+    }
 
     ProcessBreakJumpLocations(breakCount);
 
@@ -508,6 +546,12 @@ void ScriptCompiler::EmitField(sval_t listener_val, sval_t field_val, unsigned i
         EmitValue(listener_val);
         EmitOpcode(OP_STORE_FIELD, sourcePos);
         EmitOpcodeValue((unsigned int)index, sizeof(unsigned int));
+    } else if (bOptimize && listener_val.node[1].intValue == method_local && PrevOpcode() == OP_STORE_LOCAL_VAR) {
+        // both operands of an expression like local.a + local.b
+        AbsorbPrevOpcode();
+        EmitOpcode(OP_STORE_LOCAL_VAR2, sourcePos);
+        EmitOpcodeValue((unsigned int)prev_index, sizeof(unsigned int));
+        EmitOpcodeValue((unsigned int)index, sizeof(unsigned int));
     } else if (PrevOpcode() != (OP_LOAD_GAME_VAR + listener_val.node[1].intValue) || prev_index != index) {
         EmitOpcode(OP_STORE_GAME_VAR + listener_val.node[1].intValue, sourcePos);
         EmitOpcodeValue((unsigned int)index, sizeof(unsigned int));
@@ -541,6 +585,116 @@ void ScriptCompiler::EmitFunc1(int opcode, unsigned int sourcePos)
     EmitOpcode(opcode, sourcePos);
 }
 
+static bool IsConstantOpcode(int opcode)
+{
+    return (opcode >= OP_STORE_INT0 && opcode <= OP_STORE_INT4) || opcode == OP_STORE_FLOAT;
+}
+
+void ScriptCompiler::EmitFunc2(int opcode, unsigned int sourcePos)
+{
+    ScriptVariable a, b;
+    bool           bFloat;
+
+    if (!bOptimize || !IsConstantOpcode(PrevOpcode()) || !IsConstantOpcode(PrevPrevOpcode())) {
+        return EmitOpcode(opcode, sourcePos);
+    }
+
+    EvalPrevValue(b);
+    bFloat = b.GetType() == VARIABLE_FLOAT || PrevPrevOpcode() == OP_STORE_FLOAT;
+
+    // only fold what gives the same result as the opcode, without raising a script error
+    switch (opcode) {
+    case OP_BIN_EQUALITY:
+    case OP_BIN_INEQUALITY:
+    case OP_BIN_LESS_THAN:
+    case OP_BIN_GREATER_THAN:
+    case OP_BIN_LESS_THAN_OR_EQUAL:
+    case OP_BIN_GREATER_THAN_OR_EQUAL:
+    case OP_BIN_PLUS:
+    case OP_BIN_MINUS:
+    case OP_BIN_MULTIPLY:
+        break;
+    case OP_BIN_DIVIDE:
+        if (b.floatValue() == 0.0f) {
+            return EmitOpcode(opcode, sourcePos);
+        }
+        break;
+    case OP_BIN_PERCENTAGE:
+        if (bFloat || b.intValue() == 0) {
+            return EmitOpcode(opcode, sourcePos);
+        }
+        break;
+    case OP_BIN_BITWISE_AND:
+    case OP_BIN_BITWISE_OR:
+    case OP_BIN_BITWISE_EXCL_OR:
+    case OP_BIN_SHIFT_LEFT:
+    case OP_BIN_SHIFT_RIGHT:
+        if (bFloat) {
+            return EmitOpcode(opcode, sourcePos);
+        }
+        break;
+    default:
+        return EmitOpcode(opcode, sourcePos);
+    }
+
+    AbsorbPrevOpcode();
+    EvalPrevValue(a);
+    AbsorbPrevOpcode();
+
+    switch (opcode) {
+    case OP_BIN_EQUALITY:
+        a.setIntValue(a == b);
+        break;
+    case OP_BIN_INEQUALITY:
+        a.setIntValue(a != b);
+        break;
+    case OP_BIN_LESS_THAN:
+        a.lessthan(b);
+        break;
+    case OP_BIN_GREATER_THAN:
+        a.greaterthan(b);
+        break;
+    case OP_BIN_LESS_THAN_OR_EQUAL:
+        a.lessthanorequal(b);
+        break;
+    case OP_BIN_GREATER_THAN_OR_EQUAL:
+        a.greaterthanorequal(b);
+        break;
+    case OP_BIN_PLUS:
+        a += b;
+        break;
+    case OP_BIN_MINUS:
+        a -= b;
+        break;
+    case OP_BIN_MULTIPLY:
+        a *= b;
+        break;
+    case OP_BIN_DIVIDE:
+        a /= b;
+        break;
+    case OP_BIN_PERCENTAGE:
+        a %= b;
+        break;
+    case OP_BIN_BITWISE_AND:
+        a &= b;
+        break;
+    case OP_BIN_BITWISE_OR:
+        a |= b;
+        break;
+    case OP_BIN_BITWISE_EXCL_OR:
+        a ^= b;
+        break;
+    case OP_BIN_SHIFT_LEFT:
+        a <<= b;
+        break;
+    case OP_BIN_SHIFT_RIGHT:
+        a >>= b;
+        break;
+    }
+
+    EmitValue(a, sourcePos);
+}
+
 /*
 void ScriptCompiler::EmitFunction(int iParamCount, sval_t val, unsigned int sourcePos)
 {
@@ -588,10 +742,15 @@ void ScriptCompiler::EmitIfElseJump(sval_t if_stmt, sval_t else_stmt, unsigned i
     unsigned char *jmp1, *jmp2;
     int            label1, label2;
 
-    label1 = EmitNot(sourcePos);
-    jmp1   = code_pos;
-    code_pos += sizeof(unsigned int);
-    ClearPrevOpcode();
+    if (AbsorbTrueCondition()) {
+        label1 = 0;
+        jmp1   = NULL;
+    } else {
+        label1 = EmitNot(sourcePos);
+        jmp1   = code_pos;
+        code_pos += sizeof(unsigned int);
+        ClearPrevOpcode();
+    }
 
     EmitValue(if_stmt);
 
@@ -606,11 +765,15 @@ void ScriptCompiler::EmitIfElseJump(sval_t if_stmt, sval_t else_stmt, unsigned i
 
     ClearPrevOpcode();
 
-    if (showopcodes->integer) {
-        glbs.DPrintf("<LABEL%d>:\n", label1);
+    // the else block is kept even if it can't be reached, it may contain labels
+    if (jmp1) {
+        if (showopcodes->integer) {
+            glbs.DPrintf("<LABEL%d>:\n", label1);
+        }
+
+        AddJumpLocation(jmp1);
     }
 
-    AddJumpLocation(jmp1);
     EmitValue(else_stmt);
 
     if (showopcodes->integer) {
@@ -624,6 +787,11 @@ void ScriptCompiler::EmitIfJump(sval_t if_stmt, unsigned int sourcePos)
 {
     unsigned char *jmp;
 
+    if (AbsorbTrueCondition()) {
+        EmitValue(if_stmt);
+        return;
+    }
+
     int label = EmitNot(sourcePos);
     jmp       = code_pos;
     code_pos += sizeof(unsigned int);
@@ -807,6 +975,28 @@ void ScriptCompiler::EmitMethodExpression(int iParamCount, int eventnum, unsigne
     EmitOpcodeValue((unsigned int)eventnum, sizeof(unsigned int));
 }
 
+// Fuses the load of a local variable with the method called on it
+void ScriptCompiler::EmitLocalVarMethod(int opcode, int iParamCount, int eventnum, unsigned int sourcePos)
+{
+    const unsigned int index = GetOpcodeValue<unsigned int>(sizeof(unsigned int), sizeof(unsigned int));
+
+    AbsorbPrevOpcode();
+
+    // the variable is still pushed before the method is called
+    m_iVarStackOffset++;
+
+    if (opcode == OP_EXEC_CMD_METHOD_LOCAL_VAR) {
+        SetOpcodeVarStackOffset(opcode, -1 - iParamCount);
+    } else {
+        SetOpcodeVarStackOffset(opcode, -iParamCount);
+    }
+
+    EmitOpcode(opcode, sourcePos);
+    EmitOpcodeValue((unsigned int)index, sizeof(unsigned int));
+    EmitOpcodeValue((op_parmNum_t)iParamCount, sizeof(op_parmNum_t));
+    EmitOpcodeValue((op_ev_t)eventnum, sizeof(op_ev_t));
+}
+
 void ScriptCompiler::EmitNil(unsigned int sourcePos)
 {
     if (showopcodes->integer) {
@@ -1166,6 +1356,11 @@ __emit:
 
             EmitValue(val.node[1]);
 
+            if (bOptimize && PrevOpcode() == OP_STORE_LOCAL_VAR) {
+                EmitLocalVarMethod(OP_EXEC_CMD_METHOD_LOCAL_VAR, iParamCount, eventnum, val.node[4].sourcePosValue);
+                break;
+            }
+
             if (iParamCount > 5) {
                 SetOpcodeVarStackOffset(OP_EXEC_CMD_COUNT1, -(int32_t)iParamCount);
                 EmitOpcode(OP_EXEC_CMD_METHOD_COUNT1, val.node[4].sourcePosValue);
@@ -1190,7 +1385,12 @@ __emit:
             }
 
             EmitValue(val.node[1]);
-            EmitMethodExpression(iParamCount, eventnum, val.node[4].sourcePosValue);
+
+            if (bOptimize && PrevOpcode() == OP_STORE_LOCAL_VAR) {
+                EmitLocalVarMethod(OP_EXEC_METHOD_LOCAL_VAR, iParamCount, eventnum, val.node[4].sourcePosValue);
+            } else {
+                EmitMethodExpression(iParamCount, eventnum, val.node[4].sourcePosValue);
+            }
             break;
         }
 
@@ -1250,7 +1450,7 @@ __emit:
     case ENUM_func2_expr:
         EmitValue(val.node[2]);
         EmitValue(val.node[3]);
-        EmitOpcode(val.node[1].byteValue, val.node[4].sourcePosValue);
+        EmitFunc2(val.node[1].byteValue, val.node[4].sourcePosValue);
         break;
 
     case ENUM_statement_list:
@@ -1335,9 +1535,13 @@ void ScriptCompiler::EmitWhileJump(sval_t while_expr, sval_t while_stmt, sval_t
     EmitValue(while_expr);
     EmitVarToBool(sourcePos);
 
-    label2             = EmitNot(sourcePos);
-    unsigned char *jmp = code_pos;
-    code_pos += sizeof(unsigned int);
+    unsigned char *jmp = NULL;
+
+    if (!AbsorbTrueCondition()) {
+        label2 = EmitNot(sourcePos);
+        jmp    = code_pos;
+        code_pos += sizeof(unsigned int);
+    }
     ClearPrevOpcode();
 
     bool old_bCanBreak    = bCanBreak;
@@ -1363,11 +1567,13 @@ void ScriptCompiler::EmitWhileJump(sval_t while_expr, sval_t while_stmt, sval_t
 
     ClearPrevOpcode();
 
-    if (showopcodes->integer) {
-        glbs.DPrintf("<LABEL%d>:\n", label2);
-    }
+    if (jmp) {
+        if (showopcodes->integer) {
+            glbs.DPrintf("<LABEL%d>:\n", label2);
+        }
 
-    AddJumpLocation(jmp);
+        AddJumpLocation(jmp);
+    }
 
     ProcessBreakJumpLocations(breakCount);
 
@@ -1475,27 +1681,18 @@ char *ScriptCompiler::Preprocess(char *sourceBuffer)
 
 void ScriptCompiler::Preclean(char *processedBuffer) {}
 
-extern int          prev_yylex;
-extern int          out_pos;
-extern int          success_pos;
-extern const char  *start_ptr;
-extern const char  *in_ptr;
-extern parseStage_e parseStage;
-
-void yy_init_script();
+void yy_init_script(yyscan_t yyscanner);
 
-int yyerror(const char *msg)
+int yyerror(YYLTYPE *loc, yyparsedata& parsedata, yyscan_t scanner, const char *msg)
 {
     //parsedata.pos -= yyleng;
-    parsedata.exc.yylineno = prev_yylex != TOKEN_EOL ? yylineno : yylineno - 1;
-    parsedata.exc.yytext   = yytext;
+    parsedata.exc.yylineno = parsedata.prev_yylex != TOKEN_EOL ? yyget_lineno(scanner) : yyget_lineno(scanner) - 1;
+    parsedata.exc.yytext   = yyget_text(scanner);
     parsedata.exc.yytoken  = msg;
 
-    //str line = ScriptCompiler::GetLine( parsedata.sourceBuffer, parsedata.exc.yylineno );
-
     glbs.Printf("parse error:\n%s:\n", parsedata.exc.yytoken.c_str());
 
-    parsedata.gameScript->PrintSourcePos(success_pos, false);
+    parsedata.gameScript->PrintSourcePos(parsedata.success_pos, false);
     parsedata.pos++;
 
     return 1;
@@ -1503,29 +1700,32 @@ int yyerror(const char *msg)
 
 bool ScriptCompiler::Parse(GameScript *gameScript, char *sourceBuffer, const char *type, size_t& outLength)
 {
-    parsedata = yyparsedata();
+    yyscan_t scanner;
+
+    parsetree_init(parsedata);
 
     parsedata.sourceBuffer = sourceBuffer;
     parsedata.gameScript   = gameScript;
-    parsedata.braces_count = 0;
+    parsedata.compiler     = this;
 
-    start_ptr   = sourceBuffer;
-    prev_yylex  = 0;
-    out_pos     = 0;
-    success_pos = 0;
-    parseStage  = PS_TYPE;
-    in_ptr      = type;
+    parsedata.start_ptr  = sourceBuffer;
+    parsedata.parseStage = PS_TYPE;
+    parsedata.in_ptr     = type;
 
     script      = gameScript;
     stateScript = &gameScript->m_State;
 
     outLength = 0;
 
-    yy_init_script();
-    parsetree_init();
+    if (yylex_init_extra(&parsedata, &scanner)) {
+        glbs.DPrintf("Couldn't create the script scanner\n");
+        return false;
+    }
+
+    yy_init_script(scanner);
 
     try {
-        if (yyparse() != 0 || parsedata.exc.yytoken != "") {
+        if (yyparse(parsedata, scanner) != 0 || parsedata.exc.yytoken != "") {
             // an error occured
 
             if (!parsedata.exc.yytext) {
@@ -1536,16 +1736,18 @@ bool ScriptCompiler::Parse(GameScript *gameScript, char *sourceBuffer, const cha
                 }
             }
 
-            yylex_destroy();
+            yylex_destroy(scanner);
+            parsetree_freeall(parsedata);
             return false;
         }
     } catch (ScriptException& exc) {
-        yylex_destroy();
+        yylex_destroy(scanner);
+        parsetree_freeall(parsedata);
         exc;
         return false;
     }
 
-    yylex_destroy();
+    yylex_destroy(scanner);
 
     outLength = parsedata.total_length;
     return true;
@@ -1567,6 +1769,7 @@ bool ScriptCompiler::Compile(GameScript *gameScript, unsigned char *progBuffer,
     gameScript->m_ProgToSource = new con_set<const unsigned char *, sourceinfo_t>;
 
     compileSuccess = true;
+    bOptimize      = scriptoptimize->integer != 0;
 
     prev_opcodes[prev_opcode_pos].opcode = OP_PREVIOUS;
 
@@ -1590,35 +1793,11 @@ bool ScriptCompiler::Compile(GameScript *gameScript, unsigned char *progBuffer,
         prog_end_ptr = code_pos;
     }
 
-    parsetree_freeall();
+    parsetree_freeall(parsedata);
 
     return success;
 }
 
-str ScriptCompiler::GetLine(str content, int line)
-{
-    char *p;
-    str   found;
-    int   i = 1;
-
-    p = (char *)content.c_str();
-
-    while (*p) {
-        if (*p == '\n') {
-            i++;
-        }
-
-        if (i >= line) {
-            found = strtok(p, "\n");
-            break;
-        }
-
-        p++;
-    }
-
-    return found;
-}
-
 template<typename Value>
 void ScriptCompiler::EmitOpcodeValue(const Value& value, size_t size)
 {
@@ -1684,26 +1863,228 @@ void CompileAssemble(const char *filename, const char *outputfile)
     arc.Close();
 }
 
-bool GetCompiledScript(GameScript *scr)
+//
+// Compiled scripts are cached in the home directory, named after the checksum of their source.
+// A cached script is only used if it was compiled by the same game, with the same opcodes
+// and events, otherwise the source is compiled again and the cache is updated
+//
+
+#define COMPILEDSCRIPT_DIR     "scriptcache"
+#define COMPILEDSCRIPT_TEMP    COMPILEDSCRIPT_DIR "/save.tmp"
+#define COMPILEDSCRIPT_VERSION 1 // This must be changed any time the compiler output changes!
+
+struct compiledScriptHeader_t {
+    unsigned int version;
+    str          gameVersion;
+    unsigned int sourceChecksum;
+    unsigned int sourceLength;
+    unsigned int opcodeChecksum;
+    unsigned int eventChecksum;
+    bool         optimize;
+};
+
+static int numCompiledScriptHits;
+static int numCompiledScriptMisses;
+static int numCompiledScriptStores;
+
+static unsigned int OpcodeTableChecksum(void)
 {
-    /*
-    Archiver arc;
+    unsigned int checksum = 0;
+    const char  *name;
+    int          length;
+    int          i;
+
+    for (i = 0; i < OP_MAX; i++) {
+        name     = OpcodeName(i);
+        length   = OpcodeLength(i);
+        checksum = crc32(checksum, name, strlen(name));
+        checksum = crc32(checksum, &length, sizeof(length));
+    }
+
+    return checksum;
+}
+
+static unsigned int EventTableChecksum(void)
+{
+    unsigned int checksum = 0;
+    command_t   *command;
+    int          i;
+
+    // the compiler checks for builtin variables and commands
+    for (i = 1; i < Event::NumEventCommands(); i++) {
+        command  = Event::GetEventInfo(i);
+        checksum = crc32(checksum, command->command, strlen(command->command));
+        checksum = crc32(checksum, &command->type, sizeof(command->type));
+    }
+
+    return checksum;
+}
+
+static void GetCompiledScriptHeader(compiledScriptHeader_t& header, const void *sourceBuffer, size_t sourceLength)
+{
+    header.version        = COMPILEDSCRIPT_VERSION;
+    header.gameVersion    = GAME_VERSION;
+    header.sourceChecksum = crc32(0, sourceBuffer, sourceLength);
+    header.sourceLength   = sourceLength;
+    header.opcodeChecksum = OpcodeTableChecksum();
+    header.eventChecksum  = EventTableChecksum();
+    header.optimize       = scriptoptimize->integer != 0;
+}
+
+static void ArchiveCompiledScriptHeader(Archiver& arc, compiledScriptHeader_t& header)
+{
+    arc.ArchiveUnsigned(&header.version);
+    arc.ArchiveString(&header.gameVersion);
+    arc.ArchiveUnsigned(&header.sourceChecksum);
+    arc.ArchiveUnsigned(&header.sourceLength);
+    arc.ArchiveUnsigned(&header.opcodeChecksum);
+    arc.ArchiveUnsigned(&header.eventChecksum);
+    arc.ArchiveBool(&header.optimize);
+}
+
+static bool CompareCompiledScriptHeader(const compiledScriptHeader_t& header1, const compiledScriptHeader_t& header2)
+{
+    return header1.version == header2.version && header1.gameVersion == header2.gameVersion
+        && header1.sourceChecksum == header2.sourceChecksum && header1.sourceLength == header2.sourceLength
+        && header1.opcodeChecksum == header2.opcodeChecksum && header1.eventChecksum == header2.eventChecksum
+        && header1.optimize == header2.optimize;
+}
+
+static str CompiledScriptPath(const compiledScriptHeader_t& header)
+{
+    return va(COMPILEDSCRIPT_DIR "/%08x%08x.scc", header.sourceChecksum, header.sourceLength);
+}
+
+//
+// Opens the cached script and checks that it matches the source
+//
+static bool OpenCompiledScript(Archiver& arc, const compiledScriptHeader_t& header)
+{
+    compiledScriptHeader_t cachedHeader;
+    str                    path;
+
+    path = CompiledScriptPath(header);
 
     arc.SetSilent(true);
-    arc.Read(scr->Filename(), false);
 
-    if (!arc.NoErrors()) {
+    if (!arc.Read(path, false)) {
+        return false;
+    }
+
+    ArchiveCompiledScriptHeader(arc, cachedHeader);
+
+    if (!arc.NoErrors() || !CompareCompiledScriptHeader(header, cachedHeader)) {
+        arc.Close();
         return false;
     }
 
-    arc.SetSilent(false);
+    return true;
+}
+
+bool GetCompiledScript(GameScript *scr, const void *sourceBuffer, size_t sourceLength)
+{
+    compiledScriptHeader_t header;
+    Archiver               arc;
+
+    if (!g_scriptcache->integer) {
+        return false;
+    }
+
+    GetCompiledScriptHeader(header, sourceBuffer, sourceLength);
+
+    if (!OpenCompiledScript(arc, header)) {
+        numCompiledScriptMisses++;
+        return false;
+    }
 
     scr->Archive(arc);
+    arc.Close();
+
+    if (!scr->successCompile) {
+        // the source will be compiled instead
+        scr->Close();
+        numCompiledScriptMisses++;
+        return false;
+    }
+
+    scr->LoadSource(sourceBuffer, sourceLength);
+    numCompiledScriptHits++;
+
+    return true;
+}
+
+bool HasCompiledScript(const void *sourceBuffer, size_t sourceLength)
+{
+    compiledScriptHeader_t header;
+    Archiver               arc;
+
+    if (!g_scriptcache->integer) {
+        return false;
+    }
+
+    GetCompiledScriptHeader(header, sourceBuffer, sourceLength);
+
+    if (!OpenCompiledScript(arc, header)) {
+        return false;
+    }
 
     arc.Close();
 
     return true;
-    */
-    // FIXME: not used?
-    return false;
+}
+
+void SaveCompiledScript(GameScript *scr, const void *sourceBuffer, size_t sourceLength)
+{
+    compiledScriptHeader_t header;
+    Archiver               arc;
+
+    if (!g_scriptcache->integer || !scr->successCompile || !scr->m_ProgBuffer) {
+        return;
+    }
+
+    GetCompiledScriptHeader(header, sourceBuffer, sourceLength);
+
+    arc.SetSilent(true);
+
+    // the script is written to a temporary file first and then replaces the cached one,
+    // so an interrupted write never leaves a truncated script in the cache
+    if (!arc.Create(COMPILEDSCRIPT_TEMP, false)) {
+        return;
+    }
+
+    ArchiveCompiledScriptHeader(arc, header);
+    scr->Archive(arc);
+
+    if (!arc.NoErrors()) {
+        // the program couldn't be archived
+        return;
+    }
+
+    arc.Close();
+
+    if (!gi.FS_Rename(COMPILEDSCRIPT_TEMP, CompiledScriptPath(header).c_str())) {
+        return;
+    }
+
+    numCompiledScriptStores++;
+}
+
+void CompiledScriptStats(bool reset)
+{
+    const int total = numCompiledScriptHits + numCompiledScriptMisses;
+
+    gi.Printf(
+        "%d scripts: %d loaded from the cache, %d compiled (%.1f%% hits), %d stored\n",
+        total,
+        numCompiledScriptHits,
+        numCompiledScriptMisses,
+        total ? numCompiledScriptHits * 100.0 / total : 0.0,
+        numCompiledScriptStores
+    );
+
+    if (reset) {
+        numCompiledScriptHits   = 0;
+        numCompiledScriptMisses = 0;
+        numCompiledScriptStores = 0;
+    }
 }
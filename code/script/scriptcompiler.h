@@ -69,6 +69,10 @@ public:
     int            iContinueJumpLocCount;
 
     bool compileSuccess;
+    bool bOptimize;
+
+    // scanner and parser state, and the parse tree until the script is compiled
+    yyparsedata parsedata;
 
     static int current_label;
 
@@ -77,6 +81,7 @@ public:
     void Reset();
 
     unsigned char PrevOpcode();
+    unsigned char PrevPrevOpcode();
     signed char   PrevVarStackOffset();
     void          AbsorbPrevOpcode();
     void          ClearPrevOpcode();
@@ -87,6 +92,7 @@ public:
     void AddJumpLocation(unsigned char *pos);
     void AddJumpBackLocation(unsigned char *pos);
     void AddJumpToLocation(unsigned char *pos);
+    bool AbsorbTrueCondition();
 
     bool BuiltinReadVariable(unsigned int sourcePos, int type, int eventnum);
     bool BuiltinWriteVariable(unsigned int sourcePos, int type, int eventnum);
@@ -108,6 +114,7 @@ public:
     void EmitField(sval_t listener_val, sval_t field_val, unsigned int sourcePos);
     void EmitFloat(float value, unsigned int sourcePos);
     void EmitFunc1(int opcode, unsigned int sourcePos);
+    void EmitFunc2(int opcode, unsigned int sourcePos);
     //void EmitFunction(int iParamCount, sval_t val, unsigned int sourcePos);
     void EmitIfElseJump(sval_t if_stmt, sval_t else_stmt, unsigned int sourcePos);
     void EmitIfJump(sval_t if_stmt, unsigned int sourcePos);
@@ -122,6 +129,7 @@ public:
     void EmitOrJump(sval_t logic_stmt, unsigned int sourcePos);
     void EmitMakeArray(sval_t val);
     void EmitMethodExpression(int iParamCount, int eventnum, unsigned int sourcePos);
+    void EmitLocalVarMethod(int opcode, int iParamCount, int eventnum, unsigned int sourcePos);
     void EmitNil(unsigned int sourcePos);
     void EmitNop();
     int  EmitNot(unsigned int sourcePos);
@@ -154,8 +162,6 @@ public:
     bool  Parse(GameScript *m_GameScript, char *sourceBuffer, const char *type, size_t& outLength);
     bool  Compile(GameScript *m_GameScript, unsigned char *progBuffer, size_t& outLength);
 
-    static str GetLine(str content, int line);
-
 private:
     template<typename Value>
     void EmitOpcodeValue(const Value& value, size_t size);
@@ -179,4 +185,7 @@ private:
 extern ScriptCompiler Compiler;
 
 void CompileAssemble(const char *filename, const char *outputfile);
-bool GetCompiledScript(GameScript *scr);
+bool GetCompiledScript(GameScript *scr, const void *sourceBuffer, size_t sourceLength);
+bool HasCompiledScript(const void *sourceBuffer, size_t sourceLength);
+void SaveCompiledScript(GameScript *scr, const void *sourceBuffer, size_t sourceLength);
+void CompiledScriptStats(bool reset = false);
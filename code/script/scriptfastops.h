@@ -0,0 +1,241 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// scriptfastops.h: Fast paths of the script binary operators for numeric operands.
+//
+// The VM tries these before the ScriptVariable operators. They only handle integer,
+// float and vector operands whose result doesn't need a conversion, an allocation or
+// an exception, and give the same results as the operators. Anything else returns false
+// and is left to the operators.
+//
+// Variable must have the type and m_data members of ScriptVariable, and variabletype
+// and the vector macros of q_shared.h must be declared before this file.
+
+#pragma once
+
+#define FASTOP_PAIR(t1, t2) ((t1) + (t2) * VARIABLE_MAX)
+
+template<typename Variable>
+inline bool FastOpPlus(Variable& b, const Variable& a)
+{
+    switch (FASTOP_PAIR(b.type, a.type)) {
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):
+        b.m_data.intValue = b.m_data.intValue + a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):
+        b.type              = VARIABLE_FLOAT;
+        b.m_data.floatValue = (float)b.m_data.intValue + a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):
+        b.m_data.floatValue = b.m_data.floatValue + a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):
+        b.m_data.floatValue = b.m_data.floatValue + a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_VECTOR, VARIABLE_VECTOR):
+        VectorAdd(b.m_data.vectorValue, a.m_data.vectorValue, b.m_data.vectorValue);
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename Variable>
+inline bool FastOpMinus(Variable& b, const Variable& a)
+{
+    switch (FASTOP_PAIR(b.type, a.type)) {
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):
+        b.m_data.intValue = b.m_data.intValue - a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):
+        b.type              = VARIABLE_FLOAT;
+        b.m_data.floatValue = (float)b.m_data.intValue - a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):
+        b.m_data.floatValue = b.m_data.floatValue - a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):
+        b.m_data.floatValue = b.m_data.floatValue - a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_VECTOR, VARIABLE_VECTOR):
+        VectorSubtract(b.m_data.vectorValue, a.m_data.vectorValue, b.m_data.vectorValue);
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename Variable>
+inline bool FastOpMultiply(Variable& b, const Variable& a)
+{
+    switch (FASTOP_PAIR(b.type, a.type)) {
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):
+        b.m_data.intValue = b.m_data.intValue * a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):
+        b.type              = VARIABLE_FLOAT;
+        b.m_data.floatValue = (float)b.m_data.intValue * a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):
+        b.m_data.floatValue = b.m_data.floatValue * a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):
+        b.m_data.floatValue = b.m_data.floatValue * a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_VECTOR, VARIABLE_INTEGER):
+        VectorScale(b.m_data.vectorValue, (float)a.m_data.intValue, b.m_data.vectorValue);
+        return true;
+    case FASTOP_PAIR(VARIABLE_VECTOR, VARIABLE_FLOAT):
+        VectorScale(b.m_data.vectorValue, a.m_data.floatValue, b.m_data.vectorValue);
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename Variable>
+inline bool FastOpDivide(Variable& b, const Variable& a)
+{
+    switch (FASTOP_PAIR(b.type, a.type)) {
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):
+        if (!a.m_data.intValue) {
+            return false;
+        }
+        b.m_data.intValue = b.m_data.intValue / a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):
+        if (a.m_data.floatValue == 0) {
+            return false;
+        }
+        b.type              = VARIABLE_FLOAT;
+        b.m_data.floatValue = (float)b.m_data.intValue / a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):
+        if (a.m_data.floatValue == 0) {
+            return false;
+        }
+        b.m_data.floatValue = b.m_data.floatValue / a.m_data.floatValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):
+        if (!a.m_data.intValue) {
+            return false;
+        }
+        b.m_data.floatValue = b.m_data.floatValue / a.m_data.intValue;
+        return true;
+    case FASTOP_PAIR(VARIABLE_VECTOR, VARIABLE_FLOAT):
+        if (a.m_data.floatValue == 0) {
+            return false;
+        }
+        b.m_data.vectorValue[0] = b.m_data.vectorValue[0] / a.m_data.floatValue;
+        b.m_data.vectorValue[1] = b.m_data.vectorValue[1] / a.m_data.floatValue;
+        b.m_data.vectorValue[2] = b.m_data.vectorValue[2] / a.m_data.floatValue;
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename Variable>
+inline bool FastOpPercentage(Variable& b, const Variable& a)
+{
+    if (FASTOP_PAIR(b.type, a.type) != FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER) || !a.m_data.intValue) {
+        return false;
+    }
+
+    b.m_data.intValue = b.m_data.intValue % a.m_data.intValue;
+    return true;
+}
+
+#define FASTOP_INTEGER(name, op)                                                              \
+    template<typename Variable>                                                               \
+    inline bool name(Variable& b, const Variable& a)                                          \
+    {                                                                                         \
+        if (FASTOP_PAIR(b.type, a.type) != FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER)) { \
+            return false;                                                                     \
+        }                                                                                     \
+                                                                                              \
+        b.m_data.intValue op a.m_data.intValue;                                               \
+        return true;                                                                          \
+    }
+
+FASTOP_INTEGER(FastOpBitwiseAnd, &=)
+FASTOP_INTEGER(FastOpBitwiseOr, |=)
+FASTOP_INTEGER(FastOpBitwiseExclOr, ^=)
+FASTOP_INTEGER(FastOpShiftLeft, <<=)
+FASTOP_INTEGER(FastOpShiftRight, >>=)
+
+// The result of the comparison is stored in b as an integer
+template<typename Variable>
+inline bool FastOpEquality(Variable& b, const Variable& a, bool inequality)
+{
+    int result;
+
+    switch (FASTOP_PAIR(b.type, a.type)) {
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):
+        result = b.m_data.intValue == a.m_data.intValue;
+        break;
+    case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):
+        result = fabs(b.m_data.intValue - a.m_data.floatValue) < 0.0001;
+        break;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):
+        result = fabs(b.m_data.floatValue - a.m_data.floatValue) < 0.0001;
+        break;
+    case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):
+        result = fabs(b.m_data.floatValue - a.m_data.intValue) < 0.0001;
+        break;
+    default:
+        return false;
+    }
+
+    b.type            = VARIABLE_INTEGER;
+    b.m_data.intValue = inequality ? !result : result;
+    return true;
+}
+
+#define FASTOP_COMPARE(name, op, epsilonOp, epsilon)                                         \
+    template<typename Variable>                                                              \
+    inline bool name(Variable& b, const Variable& a)                                         \
+    {                                                                                        \
+        switch (FASTOP_PAIR(b.type, a.type)) {                                               \
+        case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_INTEGER):                                \
+            b.m_data.intValue = b.m_data.intValue op a.m_data.intValue;                      \
+            return true;                                                                     \
+        case FASTOP_PAIR(VARIABLE_INTEGER, VARIABLE_FLOAT):                                  \
+            b.m_data.intValue = b.m_data.intValue - a.m_data.floatValue epsilonOp epsilon;   \
+            return true;                                                                     \
+        case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_FLOAT):                                    \
+            b.type            = VARIABLE_INTEGER;                                            \
+            b.m_data.intValue = b.m_data.floatValue - a.m_data.floatValue epsilonOp epsilon; \
+            return true;                                                                     \
+        case FASTOP_PAIR(VARIABLE_FLOAT, VARIABLE_INTEGER):                                  \
+            b.type            = VARIABLE_INTEGER;                                            \
+            b.m_data.intValue = b.m_data.floatValue - a.m_data.intValue epsilonOp epsilon;   \
+            return true;                                                                     \
+        default:                                                                             \
+            return false;                                                                    \
+        }                                                                                    \
+    }
+
+FASTOP_COMPARE(FastOpGreaterThan, >, >=, 0.0001)
+FASTOP_COMPARE(FastOpGreaterThanOrEqual, >=, >, -0.0001)
+FASTOP_COMPARE(FastOpLessThan, <, <=, -0.0001)
+FASTOP_COMPARE(FastOpLessThanOrEqual, <=, <, 0.0001)
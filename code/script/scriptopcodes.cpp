@@ -92,7 +92,7 @@ static opcode_t OpcodeInfo[] = {
     {"OPCODE_LOAD_OWNER_VAR",            5,                        -1,   0},
     {"OPCODE_LOAD_FIELD_VAR",            5,                        -2,   0},
     {"OPCODE_LOAD_ARRAY_VAR",            1,                        -3,   0},
-    {"OPCODE_LOAD_CONST_ARRAY1",         2,                        -128, 0},
+    {"OPCODE_LOAD_CONST_ARRAY1",         1 + sizeof(short),        -128, 0},
 
     {"OPCODE_STORE_FIELD_REF",           5,                        0,    0},
     {"OPCODE_STORE_ARRAY_REF",           1,                        -1,   0},
@@ -153,7 +153,7 @@ static opcode_t OpcodeInfo[] = {
     {"OPCODE_UN_DEC",                    1,                        0,    0},
     {"OPCODE_UN_SIZE",                   1,                        0,    0},
 
-    {"OPCODE_SWITCH",                    5,                        -1,   0},
+    {"OPCODE_SWITCH",                    1 + sizeof(void *),       -1,   0},
 
     {"OPCODE_FUNC",                      11,                       -128, 1},
 
@@ -164,6 +164,12 @@ static opcode_t OpcodeInfo[] = {
 
     {"OPCODE_END",                       1,                        -1,   0},
     {"OPCODE_RETURN",                    1,                        -1,   0},
+
+    {"OPCODE_UN_INC_LOCAL_VAR",          5,                        0,    0},
+    {"OPCODE_UN_DEC_LOCAL_VAR",          5,                        0,    0},
+    {"OPCODE_STORE_LOCAL_VAR2",          9,                        2,    0},
+    {"OPCODE_EXEC_CMD_METHOD_LOCAL_VAR", 10,                       -128, 1},
+    {"OPCODE_EXEC_METHOD_LOCAL_VAR",     10,                       -128, 1},
 };
 
 static const char *aszVarGroupNames[] = {"game", "level", "local", "parm", "self"};
@@ -192,6 +192,13 @@ typedef enum {
     OP_END,
     OP_RETURN,
 
+    // superinstructions, only emitted when g_scriptoptimize is set
+    OP_UN_INC_LOCAL_VAR,
+    OP_UN_DEC_LOCAL_VAR,
+    OP_STORE_LOCAL_VAR2,
+    OP_EXEC_CMD_METHOD_LOCAL_VAR,
+    OP_EXEC_METHOD_LOCAL_VAR,
+
     OP_PREVIOUS,
     OP_MAX = OP_PREVIOUS
 } opcode_e;
@@ -0,0 +1,303 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// scriptprofiler.cpp: Time spent in script threads and commands.
+
+#include "../fgame/g_local.h"
+#include "../fgame/scriptmaster.h"
+#include "scriptprofiler.h"
+
+ScriptProfiler scriptProfiler;
+
+ScriptProfileKey::ScriptProfileKey()
+    : parent(0)
+    , name(0)
+{}
+
+ScriptProfileKey::ScriptProfileKey(unsigned int parentNode, unsigned int nameIndex)
+    : parent(parentNode)
+    , name(nameIndex)
+{}
+
+bool ScriptProfileKey::operator==(const ScriptProfileKey& other) const
+{
+    return parent == other.parent && name == other.name;
+}
+
+template<>
+int HashCode<ScriptProfileKey>(const ScriptProfileKey& key)
+{
+    return key.parent * 31 + key.name;
+}
+
+ScriptProfiler::ScriptProfiler()
+{
+    depth = 0;
+}
+
+/*
+====================
+Enter
+
+Starts timing name as a child of the innermost timed thread or command
+====================
+*/
+void ScriptProfiler::Enter(unsigned int name)
+{
+    scriptProfileFrame_t *frame;
+    unsigned int         *index;
+    unsigned int          parent;
+
+    if (depth >= MAX_PROFILE_DEPTH) {
+        depth++;
+        return;
+    }
+
+    parent = depth ? stack[depth - 1].node : 0;
+    index  = children.find(ScriptProfileKey(parent, name));
+
+    frame = &stack[depth++];
+
+    if (index) {
+        frame->node = *index;
+    } else {
+        frame->node = nodes.AddObject();
+
+        nodes.ObjectAt(frame->node).parent = parent;
+        nodes.ObjectAt(frame->node).name   = name;
+
+        children[ScriptProfileKey(parent, name)] = frame->node;
+    }
+
+    nodes.ObjectAt(frame->node).numCalls++;
+
+    // started last so the lookups above aren't timed
+    frame->start = qcclock_t::now();
+}
+
+void ScriptProfiler::EnterThread(GameScript *scr, unsigned char *codePos)
+{
+    unsigned int *name;
+    const_str     label;
+    str           threadName;
+
+    name = threadNames.find(codePos);
+    if (!name) {
+        // threads mostly resume at the same positions, so the labels are searched once
+        threadName = scr->Filename();
+        label      = scr->m_State.NearestLabel(codePos);
+
+        if (label) {
+            threadName += "::" + Director.GetString(label);
+        }
+
+        name  = &threadNames[codePos];
+        *name = names.addKeyIndex(threadName);
+    }
+
+    Enter(*name);
+}
+
+void ScriptProfiler::EnterCommand(int eventnum)
+{
+    unsigned int *name;
+
+    name = commandNames.find(eventnum);
+    if (!name) {
+        name  = &commandNames[eventnum];
+        *name = names.addKeyIndex(Event::GetEventName(eventnum));
+    }
+
+    Enter(*name);
+}
+
+void ScriptProfiler::Leave()
+{
+    scriptProfileFrame_t *frame;
+    long long             time;
+
+    if (!depth) {
+        // the profiler was cleared while a thread was running
+        return;
+    }
+
+    depth--;
+
+    if (depth >= MAX_PROFILE_DEPTH) {
+        return;
+    }
+
+    frame = &stack[depth];
+    time  = std::chrono::duration_cast<std::chrono::nanoseconds>(qcclock_t::now() - frame->start).count();
+
+    nodes.ObjectAt(frame->node).totalTime += time;
+
+    if (depth) {
+        nodes.ObjectAt(stack[depth - 1].node).childTime += time;
+    }
+}
+
+/*
+====================
+Clear
+
+Frees the times. Threads and commands being timed aren't recorded.
+====================
+*/
+void ScriptProfiler::Clear()
+{
+    nodes.FreeObjectList();
+    children.clear();
+    names.clear();
+    threadNames.clear();
+    commandNames.clear();
+
+    depth = 0;
+}
+
+/*
+====================
+ClearThreadNames
+
+Must be called when the scripts are freed, their code positions are reused
+====================
+*/
+void ScriptProfiler::ClearThreadNames()
+{
+    threadNames.clear();
+}
+
+typedef struct {
+    unsigned int name;
+    unsigned int numCalls;
+    long long    totalTime; // not counting the recursive calls twice
+    long long    selfTime;
+} scriptProfileName_t;
+
+static int CompareSelfTime(const void *elem1, const void *elem2)
+{
+    const long long time1 = ((const scriptProfileName_t *)elem1)->selfTime;
+    const long long time2 = ((const scriptProfileName_t *)elem2)->selfTime;
+
+    if (time1 > time2) {
+        return -1;
+    } else if (time1 < time2) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+====================
+PrintTable
+
+Prints the names taking the most time, not counting the time of their children
+====================
+*/
+void ScriptProfiler::PrintTable(int numLines)
+{
+    Container<scriptProfileName_t> table;
+    unsigned int                   parent;
+    int                            i;
+
+    table.Resize(names.size());
+
+    for (i = 1; i <= (int)names.size(); i++) {
+        table.ObjectAt(table.AddObject()).name = i;
+    }
+
+    for (i = 1; i <= nodes.NumObjects(); i++) {
+        const scriptProfileNode_t& node  = nodes.ObjectAt(i);
+        scriptProfileName_t&       entry = table.ObjectAt(node.name);
+
+        entry.numCalls += node.numCalls;
+        entry.selfTime += node.totalTime - node.childTime;
+
+        for (parent = node.parent; parent; parent = nodes.ObjectAt(parent).parent) {
+            if (nodes.ObjectAt(parent).name == node.name) {
+                break;
+            }
+        }
+
+        if (!parent) {
+            entry.totalTime += node.totalTime;
+        }
+    }
+
+    table.Sort(CompareSelfTime);
+
+    gi.Printf("     calls   total ms    self ms  name\n");
+
+    for (i = 1; i <= table.NumObjects() && i <= numLines; i++) {
+        const scriptProfileName_t& entry = table.ObjectAt(i);
+
+        gi.Printf(
+            "%10u %10.3f %10.3f  %s\n",
+            entry.numCalls,
+            entry.totalTime / 1000000.0,
+            entry.selfTime / 1000000.0,
+            names[entry.name].c_str()
+        );
+    }
+
+    gi.Printf("%u names, %d call paths\n", names.size(), nodes.NumObjects());
+}
+
+str ScriptProfiler::NodePath(unsigned int node)
+{
+    const scriptProfileNode_t& n = nodes.ObjectAt(node);
+
+    if (!n.parent) {
+        return names[n.name];
+    }
+
+    return NodePath(n.parent) + ";" + names[n.name];
+}
+
+/*
+====================
+CollapsedStacks
+
+Returns a line per call path with the microseconds spent in the path itself,
+the format read by flamegraph.pl
+====================
+*/
+str ScriptProfiler::CollapsedStacks()
+{
+    str       stacks;
+    long long selfTime;
+    int       i;
+
+    for (i = 1; i <= nodes.NumObjects(); i++) {
+        const scriptProfileNode_t& node = nodes.ObjectAt(i);
+
+        selfTime = (node.totalTime - node.childTime) / 1000;
+        if (selfTime <= 0) {
+            continue;
+        }
+
+        stacks += NodePath(i) + " " + str(va("%lld", selfTime)) + "\n";
+    }
+
+    return stacks;
+}
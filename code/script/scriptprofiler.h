@@ -0,0 +1,120 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+// scriptprofiler.h: Time spent in script threads and commands.
+//
+// While g_scriptprofile is set, each run of a thread by the VM and each command it executes
+// is timed. Times are kept per call path: a thread run is named after the file and the
+// nearest label, a command after its event name. The paths are written as collapsed stacks
+// for flamegraph.pl, and summed per name in a console table.
+
+#pragma once
+
+#include "../corepp/con_strpool.h"
+#include "../corepp/container.h"
+
+class GameScript;
+
+#define MAX_PROFILE_DEPTH 256
+
+typedef struct {
+    unsigned int parent; // 0 for the runs started from the game
+    unsigned int name;
+    unsigned int numCalls;
+    long long    totalTime; // nanoseconds, including the children
+    long long    childTime;
+} scriptProfileNode_t;
+
+typedef struct {
+    unsigned int node;
+    qctime_t     start;
+} scriptProfileFrame_t;
+
+class ScriptProfileKey
+{
+public:
+    unsigned int parent;
+    unsigned int name;
+
+public:
+    ScriptProfileKey();
+    ScriptProfileKey(unsigned int parentNode, unsigned int nameIndex);
+
+    bool operator==(const ScriptProfileKey& other) const;
+};
+
+template<>
+int HashCode<ScriptProfileKey>(const ScriptProfileKey& key);
+
+class ScriptProfiler
+{
+private:
+    con_strpool                             names;
+    Container<scriptProfileNode_t>          nodes;
+    con_map<ScriptProfileKey, unsigned int> children;
+    con_map<unsigned char *, unsigned int>  threadNames;  // by code position
+    con_map<int, unsigned int>              commandNames; // by event number
+
+    scriptProfileFrame_t stack[MAX_PROFILE_DEPTH];
+    int                  depth; // can exceed MAX_PROFILE_DEPTH, the deeper frames aren't timed
+
+private:
+    void Enter(unsigned int name);
+    str  NodePath(unsigned int node);
+
+public:
+    ScriptProfiler();
+
+    void EnterThread(GameScript *scr, unsigned char *codePos);
+    void EnterCommand(int eventnum);
+    void Leave();
+
+    void Clear();
+    void ClearThreadNames();
+
+    void PrintTable(int numLines);
+    str  CollapsedStacks();
+};
+
+extern ScriptProfiler scriptProfiler;
+
+// Leaves the profiled thread or command when the block is left, even by an exception
+class ScriptProfileScope
+{
+public:
+    bool active;
+
+public:
+    ScriptProfileScope();
+    ~ScriptProfileScope();
+};
+
+inline ScriptProfileScope::ScriptProfileScope()
+    : active(false)
+{}
+
+inline ScriptProfileScope::~ScriptProfileScope()
+{
+    if (active) {
+        scriptProfiler.Leave();
+    }
+}
@@ -80,8 +80,52 @@ void con_set<ScriptVariable, ScriptVariable>::Entry::Archive(Archiver& arc)
 
 void ScriptArrayHolder::Archive(Archiver& arc)
 {
+    ScriptVariable     key;
+    unsigned int       length;
+    unsigned int       threshold;
+    unsigned int       num;
+    short unsigned int lengthIndex;
+    unsigned int       i;
+
     arc.ArchiveUnsigned(&refCount);
-    arrayValue.Archive(arc);
+
+    if (arc.Loading()) {
+        // arrays are always saved as maps
+        arrayValue.Archive(arc);
+        isDense = !arrayValue.size();
+        return;
+    }
+
+    if (!isDense) {
+        arrayValue.Archive(arc);
+        return;
+    }
+
+    //
+    // Write what con_set::Archive would write for the same keys and values
+    //
+    length      = 1;
+    threshold   = 0;
+    lengthIndex = 0;
+    num         = denseSize;
+
+    if (num) {
+        for (length = CON_SET_MIN_LENGTH; length - length / 4 < num; length *= 2) {}
+
+        threshold   = length - length / 4;
+        lengthIndex = con_set_log2(length);
+    }
+
+    arc.ArchiveUnsigned(&length);
+    arc.ArchiveUnsigned(&threshold);
+    arc.ArchiveUnsigned(&num);
+    arc.ArchiveUnsignedShort(&lengthIndex);
+
+    for (i = 1; i <= denseSize; i++) {
+        key.setIntValue(i);
+        key.ArchiveInternal(arc);
+        DenseValueAt(i)->ArchiveInternal(arc);
+    }
 }
 
 void ScriptArrayHolder::Archive(Archiver& arc, ScriptArrayHolder *& arrayValue)
@@ -205,10 +249,10 @@ void ScriptVariable::ArchiveInternal(Archiver& arc)
     switch (type) {
     case VARIABLE_STRING:
         if (arc.Loading()) {
-            m_data.stringValue = new str;
+            m_data.stringValue = new ScriptStringHolder;
         }
 
-        arc.ArchiveString(m_data.stringValue);
+        arc.ArchiveString(&m_data.stringValue->string);
         break;
 
     case VARIABLE_INTEGER:
@@ -298,10 +342,192 @@ void ScriptVariable::MakePrimitive()
 }
 #endif
 
+ScriptStringHolder::ScriptStringHolder()
+    : refCount(0)
+{}
+
+ScriptStringHolder::ScriptStringHolder(const str& value)
+    : string(value)
+    , refCount(0)
+{}
+
 ScriptArrayHolder::ScriptArrayHolder()
     : refCount(0)
+    , denseChunks(NULL)
+    , numDenseChunks(0)
+    , maxDenseChunks(0)
+    , denseSize(0)
+    , isDense(true)
 {}
 
+ScriptArrayHolder::~ScriptArrayHolder()
+{
+    FreeDenseValues();
+}
+
+ScriptVariable *ScriptArrayHolder::DenseValueAt(unsigned int index) const
+{
+    const unsigned int chunk = con_set_log2(index);
+
+    return &denseChunks[chunk][index - (1 << chunk)];
+}
+
+ScriptVariable& ScriptArrayHolder::AddDenseValue(void)
+{
+    const unsigned int index = ++denseSize;
+
+    if (index == (1u << numDenseChunks)) {
+        if (numDenseChunks == maxDenseChunks) {
+            ScriptVariable **oldChunks = denseChunks;
+
+            maxDenseChunks = maxDenseChunks ? maxDenseChunks * 2 : 4;
+            denseChunks    = new ScriptVariable *[maxDenseChunks];
+
+            if (oldChunks) {
+                memcpy(denseChunks, oldChunks, sizeof(ScriptVariable *) * numDenseChunks);
+                delete[] oldChunks;
+            }
+        }
+
+        denseChunks[numDenseChunks] = new ScriptVariable[1 << numDenseChunks];
+        numDenseChunks++;
+    }
+
+    return *DenseValueAt(index);
+}
+
+void ScriptArrayHolder::FreeDenseValues(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < numDenseChunks; i++) {
+        delete[] denseChunks[i];
+    }
+
+    if (denseChunks) {
+        delete[] denseChunks;
+    }
+
+    denseChunks    = NULL;
+    numDenseChunks = 0;
+    maxDenseChunks = 0;
+    denseSize      = 0;
+}
+
+void ScriptArrayHolder::ConvertToMap(void)
+{
+    ScriptVariable key;
+    unsigned int   i;
+
+    if (denseSize) {
+        arrayValue.resize(denseSize);
+    }
+
+    for (i = 1; i <= denseSize; i++) {
+        key.setIntValue(i);
+        arrayValue[key] = std::move(*DenseValueAt(i));
+    }
+
+    FreeDenseValues();
+    isDense = false;
+}
+
+ScriptVariable *ScriptArrayHolder::Find(const ScriptVariable& index)
+{
+    if (!isDense) {
+        return arrayValue.find(index);
+    }
+
+    if (index.GetType() != VARIABLE_INTEGER) {
+        if (denseSize) {
+            // throws on keys that can't be hashed, like the map does
+            HashCode<ScriptVariable>(index);
+        }
+
+        return NULL;
+    }
+
+    if (index.m_data.intValue < 1 || (unsigned int)index.m_data.intValue > denseSize) {
+        return NULL;
+    }
+
+    return DenseValueAt(index.m_data.intValue);
+}
+
+ScriptVariable& ScriptArrayHolder::Add(const ScriptVariable& index)
+{
+    if (isDense && index.GetType() == VARIABLE_INTEGER && index.m_data.intValue >= 1) {
+        if ((unsigned int)index.m_data.intValue <= denseSize) {
+            return *DenseValueAt(index.m_data.intValue);
+        }
+
+        if ((unsigned int)index.m_data.intValue == denseSize + 1) {
+            return AddDenseValue();
+        }
+    }
+
+    if (isDense) {
+        ConvertToMap();
+    }
+
+    return arrayValue[index];
+}
+
+void ScriptArrayHolder::Remove(const ScriptVariable& index)
+{
+    ScriptVariable *value;
+
+    if (!isDense) {
+        arrayValue.remove(index);
+        return;
+    }
+
+    value = Find(index);
+    if (!value) {
+        return;
+    }
+
+    if ((unsigned int)index.m_data.intValue == denseSize) {
+        value->Clear();
+        denseSize--;
+        return;
+    }
+
+    ConvertToMap();
+    arrayValue.remove(index);
+}
+
+unsigned int ScriptArrayHolder::Size(void) const
+{
+    if (isDense) {
+        return denseSize;
+    }
+
+    return arrayValue.size();
+}
+
+void ScriptArrayHolder::CopyValues(ScriptVariable *values)
+{
+    con_map_enum<ScriptVariable, ScriptVariable> en;
+    ScriptVariable                              *value;
+    unsigned int                                 i;
+
+    if (isDense) {
+        for (i = 1; i <= denseSize; i++) {
+            values[i - 1] = *DenseValueAt(i);
+        }
+
+        return;
+    }
+
+    en = arrayValue;
+
+    i = 0;
+    for (value = en.NextValue(); value != NULL; value = en.NextValue(), i++) {
+        values[i] = *value;
+    }
+}
+
 ScriptConstArrayHolder::ScriptConstArrayHolder(ScriptVariable *pVar, unsigned int size)
 {
     refCount   = 0;
@@ -430,11 +656,8 @@ void ScriptVariable::CastBoolean(void)
 
 void ScriptVariable::CastConstArrayValue(void)
 {
-    con_map_enum<ScriptVariable, ScriptVariable> en;
-    ScriptConstArrayHolder                      *constArrayValue;
-    ScriptVariable                              *value;
-    int                                          i;
-    ConList                                     *listeners;
+    ScriptConstArrayHolder *constArrayValue;
+    ConList                *listeners;
 
     switch (GetType()) {
     case VARIABLE_POINTER:
@@ -446,16 +669,8 @@ void ScriptVariable::CastConstArrayValue(void)
         return;
 
     case VARIABLE_ARRAY:
-        constArrayValue = new ScriptConstArrayHolder(m_data.arrayValue->arrayValue.size());
-
-        en = m_data.arrayValue->arrayValue;
-
-        i = 1;
-
-        for (value = en.NextValue(); value != NULL; value = en.NextValue(), i++) {
-            constArrayValue->constArrayValue[i - 1] = *value;
-        }
-
+        constArrayValue = new ScriptConstArrayHolder(m_data.arrayValue->Size());
+        m_data.arrayValue->CopyValues(constArrayValue->constArrayValue);
         break;
 
     case VARIABLE_CONTAINER:
@@ -523,7 +738,12 @@ void ScriptVariable::ClearInternal()
     switch (GetType()) {
     case VARIABLE_STRING:
         if (m_data.stringValue) {
-            delete m_data.stringValue;
+            if (m_data.stringValue->refCount) {
+                m_data.stringValue->refCount--;
+            } else {
+                delete m_data.stringValue;
+            }
+
             m_data.stringValue = NULL;
         }
 
@@ -695,7 +915,7 @@ void ScriptVariable::PrintValue(void)
 #endif
 
     case VARIABLE_STRING:
-        printf("%s", m_data.stringValue->c_str());
+        printf("%s", m_data.stringValue->string.c_str());
         break;
 
     case VARIABLE_INTEGER:
@@ -749,7 +969,7 @@ int ScriptVariable::arraysize(void) const
         return -1;
 
     case VARIABLE_ARRAY:
-        return m_data.arrayValue->arrayValue.size();
+        return m_data.arrayValue->Size();
 
     case VARIABLE_CONSTARRAY:
         return m_data.constArrayValue->size;
@@ -789,7 +1009,7 @@ size_t ScriptVariable::size(void) const
         return *m_data.listenerValue != NULL;
 
     case VARIABLE_ARRAY:
-        return m_data.arrayValue->arrayValue.size();
+        return m_data.arrayValue->Size();
 
     case VARIABLE_CONSTARRAY:
         return m_data.constArrayValue->size;
@@ -849,11 +1069,7 @@ bool ScriptVariable::booleanValue(void) const
         return false;
 
     case VARIABLE_STRING:
-        if (m_data.stringValue) {
-            return m_data.stringValue->length() != 0;
-        }
-
-        return false;
+        return m_data.stringValue->string.length() != 0;
 
     case VARIABLE_INTEGER:
         return m_data.intValue != 0;
@@ -995,7 +1211,7 @@ void ScriptVariable::evalArrayAt(ScriptVariable& var)
         break;
 
     case VARIABLE_ARRAY:
-        array = m_data.arrayValue->arrayValue.find(var);
+        array = m_data.arrayValue->Find(var);
 
         if (array) {
             *this = *array;
@@ -1161,7 +1377,7 @@ str ScriptVariable::stringValue() const
 #endif
 
     case VARIABLE_STRING:
-        return *m_data.stringValue;
+        return m_data.stringValue->string;
 
     case VARIABLE_INTEGER:
         return str(m_data.intValue);
@@ -1322,16 +1538,16 @@ void ScriptVariable::setArrayAtRef(ScriptVariable& index, ScriptVariable& value)
         m_data.arrayValue = new ScriptArrayHolder;
 
         if (value.GetType() != VARIABLE_NONE) {
-            m_data.arrayValue->arrayValue[index] = value;
+            m_data.arrayValue->Add(index) = value;
         }
 
         break;
 
     case VARIABLE_ARRAY:
         if (value.GetType() == VARIABLE_NONE) {
-            m_data.arrayValue->arrayValue.remove(index);
+            m_data.arrayValue->Remove(index);
         } else {
-            m_data.arrayValue->arrayValue[index] = value;
+            m_data.arrayValue->Add(index) = value;
         }
         break;
 
@@ -1474,14 +1690,16 @@ void ScriptVariable::setRefValue(ScriptVariable *ref)
 
 void ScriptVariable::setStringValue(str newvalue)
 {
-    str *s;
+    if (type == VARIABLE_STRING && !m_data.stringValue->refCount) {
+        // not shared, reuse the holder
+        m_data.stringValue->string = newvalue;
+        return;
+    }
 
     ClearInternal();
     type = VARIABLE_STRING;
 
-    s = new str(newvalue);
-
-    m_data.stringValue = s;
+    m_data.stringValue = new ScriptStringHolder(newvalue);
 }
 
 void ScriptVariable::setVectorValue(const Vector& newvector)
@@ -2092,7 +2310,8 @@ ScriptVariable& ScriptVariable::operator=(const ScriptVariable& variable)
             break;
 
         case VARIABLE_STRING:
-            m_data.stringValue = new str(*variable.m_data.stringValue);
+            m_data.stringValue = variable.m_data.stringValue;
+            m_data.stringValue->refCount++;
             break;
 
         case VARIABLE_FLOAT:
@@ -2151,7 +2370,9 @@ ScriptVariable& ScriptVariable::operator=(const ScriptVariable& variable)
             break;
 
         case VARIABLE_STRING:
-            *m_data.stringValue = *variable.m_data.stringValue;
+            ClearInternal();
+            m_data.stringValue = variable.m_data.stringValue;
+            m_data.stringValue->refCount++;
             break;
 
         case VARIABLE_FLOAT:
@@ -2238,10 +2459,10 @@ ScriptVariable& ScriptVariable::operator[](ScriptVariable& index)
         type = VARIABLE_ARRAY;
 
         m_data.arrayValue = new ScriptArrayHolder;
-        return m_data.arrayValue->arrayValue[index];
+        return m_data.arrayValue->Add(index);
 
     case VARIABLE_ARRAY:
-        return m_data.arrayValue->arrayValue[index];
+        return m_data.arrayValue->Add(index);
 
     case VARIABLE_CONSTARRAY:
         i = index.intValue();
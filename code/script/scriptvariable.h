@@ -67,6 +67,7 @@ static const char *typenames[] = {
     "double"
 };
 
+class ScriptStringHolder;
 class ScriptArrayHolder;
 class ScriptConstArrayHolder;
 class ScriptPointer;
@@ -81,13 +82,13 @@ public:
 
     union {
     public:
-        char               charValue;
-        float              floatValue;
-        int                intValue;
-        SafePtr<Listener> *listenerValue;
-        str               *stringValue;
-        float             *vectorValue;
-        void              *anyValue;
+        char                charValue;
+        float               floatValue;
+        int                 intValue;
+        SafePtr<Listener>  *listenerValue;
+        ScriptStringHolder *stringValue;
+        float              *vectorValue;
+        void               *anyValue;
 
         ScriptVariable *refValue;
 
@@ -241,14 +242,50 @@ public:
     void MakePrimitive();
 };
 
+// Strings are shared between copies of a variable, they are never modified in place
+class ScriptStringHolder : public LightClass
+{
+public:
+    str          string;
+    unsigned int refCount;
+
+public:
+    ScriptStringHolder();
+    ScriptStringHolder(const str& value);
+};
+
+//
+// Arrays start dense: as long as the keys are the integers 1 to denseSize,
+// the values are stored in chunks indexed by key, each chunk is twice as large
+// as the previous one. The first other key moves the values to arrayValue for good.
+//
 class ScriptArrayHolder : public LightClass
 {
 public:
     con_map<ScriptVariable, ScriptVariable> arrayValue;
     unsigned int                            refCount;
 
+    ScriptVariable **denseChunks; // chunk n holds keys 2^n to 2^(n+1)-1
+    unsigned int     numDenseChunks;
+    unsigned int     maxDenseChunks;
+    unsigned int     denseSize;
+    bool             isDense;
+
+protected:
+    ScriptVariable *DenseValueAt(unsigned int index) const;
+    ScriptVariable& AddDenseValue(void);
+    void            FreeDenseValues(void);
+    void            ConvertToMap(void);
+
 public:
     ScriptArrayHolder();
+    ~ScriptArrayHolder();
+
+    ScriptVariable *Find(const ScriptVariable& index);
+    ScriptVariable& Add(const ScriptVariable& index);
+    void            Remove(const ScriptVariable& index);
+    unsigned int    Size(void) const;
+    void            CopyValues(ScriptVariable *values);
 
     void        Archive(Archiver& arc);
     static void Archive(Archiver& arc, ScriptArrayHolder *& arrayValue);
@@ -295,17 +332,10 @@ class con_set_Entry<short3, ScriptVariable>
     friend con_set<short3, ScriptVariable>;
     friend con_set_enum<short3, ScriptVariable>;
 
-private:
-    con_set_Entry *next;
-
 public:
     ScriptVariable value;
 
 public:
-    void *operator new(size_t size) { return con_set<short3, ScriptVariable>::NewEntry(size); }
-
-    void operator delete(void *ptr) { con_set<short3, ScriptVariable>::DeleteEntry(ptr); }
-
 #    ifdef ARCHIVE_SUPPORTED
     void Archive(Archiver& arc) { value.Archive(arc); }
 #    endif
@@ -29,6 +29,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "scriptvm.h"
 #include "scriptcompiler.h"
 #include "scriptexception.h"
+#include "scriptfastops.h"
+#include "scriptprofiler.h"
 #include "../fgame/game.h"
 #include "../fgame/level.h"
 #include "../fgame/parm.h"
@@ -53,10 +55,53 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #endif
 
+//
+// With GCC and Clang, opcodes are dispatched with computed gotos: each opcode jumps directly
+// to the next one, giving the branch predictor one indirect jump per opcode instead of
+// a single shared one. The switch is used by other compilers, or when SCRIPTVM_SWITCH_DISPATCH
+// is defined.
+//
+#if defined(__GNUC__) && !defined(SCRIPTVM_SWITCH_DISPATCH)
+#    define SCRIPTVM_COMPUTED_GOTO
+#endif
+
+// number of opcodes between two checks of the maximum execution time
+#define SCRIPTVM_COMMANDS_PER_CHECK 15000
+
+// threads resumed by the scheduler can be preempted on backward jumps and function calls
+#define VM_CHECK_BUDGET()                                       \
+    if (Director.m_bBudgetActive && Director.stackCount == 1) { \
+        Director.CheckBudget(m_Thread);                         \
+    }
+
+#ifdef SCRIPTVM_COMPUTED_GOTO
+
+#    define VM_CASE(op) \
+    case op:            \
+    vm_##op
+
+// the switch is left when something has to be checked between opcodes
+#    define VM_NEXT()                                                                                  \
+        if (bTraced || state != STATE_RUNNING || Director.cmdCount + 1 >= SCRIPTVM_COMMANDS_PER_CHECK) { \
+            break;                                                                                     \
+        }                                                                                              \
+        Director.cmdCount++;                                                                           \
+        m_PrevCodePos = m_CodePos;                                                                     \
+        opcode        = m_CodePos++;                                                                   \
+        goto *dispatchTable[*opcode]
+
+#else
+
+#    define VM_CASE(op) case op
+#    define VM_NEXT()   break
+
+#endif
+
 static const ScriptVM *currentScriptFile;
 static unsigned int    currentScriptLine;
 
-class ScriptCommandEvent : public Event
+// Script commands are dispatched immediately, large argument lists come from the frame arena
+class ScriptCommandEvent : public TransientEvent
 {
 public:
     ScriptCommandEvent(unsigned int eventNum);
@@ -64,13 +109,13 @@ public:
 };
 
 ScriptCommandEvent::ScriptCommandEvent(unsigned int eventNum)
-    : Event(eventNum)
+    : TransientEvent(eventNum)
 {
     fromScript = true;
 }
 
 ScriptCommandEvent::ScriptCommandEvent(unsigned int eventNum, int numArgs)
-    : Event(eventNum, numArgs)
+    : TransientEvent(eventNum, numArgs)
 {
     fromScript = true;
 }
@@ -540,8 +585,15 @@ void ScriptVM::executeCommandInternal<false>(
     Event& ev, Listener *listener, ScriptVariable *fromVar, op_parmNum_t iParamCount
 )
 {
+    ScriptProfileScope profile;
+
     transferVarsToEvent(ev, fromVar, iParamCount);
 
+    if (g_scriptprofile->integer) {
+        scriptProfiler.EnterCommand(ev.eventnum);
+        profile.active = true;
+    }
+
     checkValidEvent(ev, listener);
     listener->ProcessScriptEvent(ev);
 }
@@ -551,8 +603,15 @@ void ScriptVM::executeCommandInternal<true>(
     Event& ev, Listener *listener, ScriptVariable *fromVar, op_parmNum_t iParamCount
 )
 {
+    ScriptProfileScope profile;
+
     transferVarsToEvent(ev, fromVar, iParamCount);
 
+    if (g_scriptprofile->integer) {
+        scriptProfiler.EnterCommand(ev.eventnum);
+        profile.active = true;
+    }
+
     try {
         checkValidEvent(ev, listener);
         listener->ProcessScriptEvent(ev);
@@ -1017,20 +1076,7 @@ Executes a program
 */
 void ScriptVM::Execute(ScriptVariable *data, int dataSize, str label)
 {
-    unsigned char *opcode;
-
-    ScriptVariable *a;
-    ScriptVariable *b;
-    ScriptVariable *c;
-
-    op_name_t fieldNameIndex;
-
-    Listener *listener;
-
-    Event           ev;
-    ScriptVariable *var = NULL;
-
-    TargetList *targetList;
+    ScriptProfileScope profile;
 
     if (Director.stackCount >= MAX_STACK_DEPTH) {
         state = STATE_EXECUTION;
@@ -1055,6 +1101,11 @@ void ScriptVM::Execute(ScriptVariable *data, int dataSize, str label)
         );
     }
 
+    if (g_scriptprofile->integer) {
+        scriptProfiler.EnterThread(GetScript(), m_CodePos);
+        profile.active = true;
+    }
+
     Director.stackCount++;
 
     if (dataSize) {
@@ -1064,7 +1115,199 @@ void ScriptVM::Execute(ScriptVariable *data, int dataSize, str label)
     state = STATE_RUNNING;
 
     while (state == STATE_RUNNING) {
-        if (g_scripttrace->integer && CanScriptTracePrint()) {
+        try {
+            // the trace check is done once per run of opcodes, not before each opcode
+            if (g_scripttrace->integer && CanScriptTracePrint()) {
+                ExecuteOpcodes<true>();
+            } else {
+                ExecuteOpcodes<false>();
+            }
+        } catch (ScriptException& exc) {
+            HandleScriptException(exc);
+        }
+    }
+
+    Director.stackCount--;
+
+    if (g_scripttrace->integer && CanScriptTracePrint()) {
+        gi.DPrintf2(
+            "---FRAME: %i (%p) -------------------------------------------------------------------\n",
+            Director.stackCount,
+            this
+        );
+    }
+
+    switch (state) {
+    case STATE_WAITING:
+        delete m_Thread;
+        delete this;
+        break;
+    case STATE_SUSPENDED:
+        state = STATE_EXECUTION;
+        break;
+    case STATE_DESTROYED:
+        delete this;
+        break;
+    }
+}
+
+/*
+====================
+ExecuteOpcodes
+
+Interprets opcodes until the VM stops running.
+The traced variant prints each opcode, and returns when tracing is turned off.
+====================
+*/
+template<bool bTraced>
+void ScriptVM::ExecuteOpcodes()
+{
+    unsigned char *opcode;
+
+    ScriptVariable *a;
+    ScriptVariable *b;
+    ScriptVariable *c;
+
+    op_name_t fieldNameIndex;
+
+    Listener *listener;
+
+    TargetList *targetList;
+
+#ifdef SCRIPTVM_COMPUTED_GOTO
+    static void *dispatchTable[256];
+
+    if (!dispatchTable[0]) {
+        for (int i = 0; i < 256; i++) {
+            dispatchTable[i] = &&vm_default;
+        }
+
+        dispatchTable[OP_BIN_BITWISE_AND]           = &&vm_OP_BIN_BITWISE_AND;
+        dispatchTable[OP_BIN_BITWISE_OR]            = &&vm_OP_BIN_BITWISE_OR;
+        dispatchTable[OP_BIN_BITWISE_EXCL_OR]       = &&vm_OP_BIN_BITWISE_EXCL_OR;
+        dispatchTable[OP_BIN_EQUALITY]              = &&vm_OP_BIN_EQUALITY;
+        dispatchTable[OP_BIN_INEQUALITY]            = &&vm_OP_BIN_INEQUALITY;
+        dispatchTable[OP_BIN_GREATER_THAN]          = &&vm_OP_BIN_GREATER_THAN;
+        dispatchTable[OP_BIN_GREATER_THAN_OR_EQUAL] = &&vm_OP_BIN_GREATER_THAN_OR_EQUAL;
+        dispatchTable[OP_BIN_LESS_THAN]             = &&vm_OP_BIN_LESS_THAN;
+        dispatchTable[OP_BIN_LESS_THAN_OR_EQUAL]    = &&vm_OP_BIN_LESS_THAN_OR_EQUAL;
+        dispatchTable[OP_BIN_PLUS]                  = &&vm_OP_BIN_PLUS;
+        dispatchTable[OP_BIN_MINUS]                 = &&vm_OP_BIN_MINUS;
+        dispatchTable[OP_BIN_MULTIPLY]              = &&vm_OP_BIN_MULTIPLY;
+        dispatchTable[OP_BIN_DIVIDE]                = &&vm_OP_BIN_DIVIDE;
+        dispatchTable[OP_BIN_PERCENTAGE]            = &&vm_OP_BIN_PERCENTAGE;
+        dispatchTable[OP_BIN_SHIFT_LEFT]            = &&vm_OP_BIN_SHIFT_LEFT;
+        dispatchTable[OP_BIN_SHIFT_RIGHT]           = &&vm_OP_BIN_SHIFT_RIGHT;
+        dispatchTable[OP_BOOL_JUMP_FALSE4]          = &&vm_OP_BOOL_JUMP_FALSE4;
+        dispatchTable[OP_BOOL_JUMP_TRUE4]           = &&vm_OP_BOOL_JUMP_TRUE4;
+        dispatchTable[OP_VAR_JUMP_FALSE4]           = &&vm_OP_VAR_JUMP_FALSE4;
+        dispatchTable[OP_VAR_JUMP_TRUE4]            = &&vm_OP_VAR_JUMP_TRUE4;
+        dispatchTable[OP_BOOL_LOGICAL_AND]          = &&vm_OP_BOOL_LOGICAL_AND;
+        dispatchTable[OP_BOOL_LOGICAL_OR]           = &&vm_OP_BOOL_LOGICAL_OR;
+        dispatchTable[OP_VAR_LOGICAL_AND]           = &&vm_OP_VAR_LOGICAL_AND;
+        dispatchTable[OP_VAR_LOGICAL_OR]            = &&vm_OP_VAR_LOGICAL_OR;
+        dispatchTable[OP_BOOL_STORE_FALSE]          = &&vm_OP_BOOL_STORE_FALSE;
+        dispatchTable[OP_BOOL_STORE_TRUE]           = &&vm_OP_BOOL_STORE_TRUE;
+        dispatchTable[OP_BOOL_UN_NOT]               = &&vm_OP_BOOL_UN_NOT;
+        dispatchTable[OP_CALC_VECTOR]               = &&vm_OP_CALC_VECTOR;
+        dispatchTable[OP_EXEC_CMD0]                 = &&vm_OP_EXEC_CMD0;
+        dispatchTable[OP_EXEC_CMD1]                 = &&vm_OP_EXEC_CMD1;
+        dispatchTable[OP_EXEC_CMD2]                 = &&vm_OP_EXEC_CMD2;
+        dispatchTable[OP_EXEC_CMD3]                 = &&vm_OP_EXEC_CMD3;
+        dispatchTable[OP_EXEC_CMD4]                 = &&vm_OP_EXEC_CMD4;
+        dispatchTable[OP_EXEC_CMD5]                 = &&vm_OP_EXEC_CMD5;
+        dispatchTable[OP_EXEC_CMD_COUNT1]           = &&vm_OP_EXEC_CMD_COUNT1;
+        dispatchTable[OP_EXEC_CMD_METHOD0]          = &&vm_OP_EXEC_CMD_METHOD0;
+        dispatchTable[OP_EXEC_CMD_METHOD1]          = &&vm_OP_EXEC_CMD_METHOD1;
+        dispatchTable[OP_EXEC_CMD_METHOD2]          = &&vm_OP_EXEC_CMD_METHOD2;
+        dispatchTable[OP_EXEC_CMD_METHOD3]          = &&vm_OP_EXEC_CMD_METHOD3;
+        dispatchTable[OP_EXEC_CMD_METHOD4]          = &&vm_OP_EXEC_CMD_METHOD4;
+        dispatchTable[OP_EXEC_CMD_METHOD5]          = &&vm_OP_EXEC_CMD_METHOD5;
+        dispatchTable[OP_EXEC_CMD_METHOD_COUNT1]    = &&vm_OP_EXEC_CMD_METHOD_COUNT1;
+        dispatchTable[OP_EXEC_METHOD0]              = &&vm_OP_EXEC_METHOD0;
+        dispatchTable[OP_EXEC_METHOD1]              = &&vm_OP_EXEC_METHOD1;
+        dispatchTable[OP_EXEC_METHOD2]              = &&vm_OP_EXEC_METHOD2;
+        dispatchTable[OP_EXEC_METHOD3]              = &&vm_OP_EXEC_METHOD3;
+        dispatchTable[OP_EXEC_METHOD4]              = &&vm_OP_EXEC_METHOD4;
+        dispatchTable[OP_EXEC_METHOD5]              = &&vm_OP_EXEC_METHOD5;
+        dispatchTable[OP_EXEC_METHOD_COUNT1]        = &&vm_OP_EXEC_METHOD_COUNT1;
+        dispatchTable[OP_FUNC]                      = &&vm_OP_FUNC;
+        dispatchTable[OP_JUMP4]                     = &&vm_OP_JUMP4;
+        dispatchTable[OP_JUMP_BACK4]                = &&vm_OP_JUMP_BACK4;
+        dispatchTable[OP_LOAD_ARRAY_VAR]            = &&vm_OP_LOAD_ARRAY_VAR;
+        dispatchTable[OP_LOAD_FIELD_VAR]            = &&vm_OP_LOAD_FIELD_VAR;
+        dispatchTable[OP_LOAD_CONST_ARRAY1]         = &&vm_OP_LOAD_CONST_ARRAY1;
+        dispatchTable[OP_LOAD_GAME_VAR]             = &&vm_OP_LOAD_GAME_VAR;
+        dispatchTable[OP_LOAD_GROUP_VAR]            = &&vm_OP_LOAD_GROUP_VAR;
+        dispatchTable[OP_LOAD_LEVEL_VAR]            = &&vm_OP_LOAD_LEVEL_VAR;
+        dispatchTable[OP_LOAD_LOCAL_VAR]            = &&vm_OP_LOAD_LOCAL_VAR;
+        dispatchTable[OP_LOAD_OWNER_VAR]            = &&vm_OP_LOAD_OWNER_VAR;
+        dispatchTable[OP_LOAD_PARM_VAR]             = &&vm_OP_LOAD_PARM_VAR;
+        dispatchTable[OP_LOAD_SELF_VAR]             = &&vm_OP_LOAD_SELF_VAR;
+        dispatchTable[OP_LOAD_STORE_GAME_VAR]       = &&vm_OP_LOAD_STORE_GAME_VAR;
+        dispatchTable[OP_LOAD_STORE_GROUP_VAR]      = &&vm_OP_LOAD_STORE_GROUP_VAR;
+        dispatchTable[OP_LOAD_STORE_LEVEL_VAR]      = &&vm_OP_LOAD_STORE_LEVEL_VAR;
+        dispatchTable[OP_LOAD_STORE_LOCAL_VAR]      = &&vm_OP_LOAD_STORE_LOCAL_VAR;
+        dispatchTable[OP_LOAD_STORE_OWNER_VAR]      = &&vm_OP_LOAD_STORE_OWNER_VAR;
+        dispatchTable[OP_LOAD_STORE_PARM_VAR]       = &&vm_OP_LOAD_STORE_PARM_VAR;
+        dispatchTable[OP_LOAD_STORE_SELF_VAR]       = &&vm_OP_LOAD_STORE_SELF_VAR;
+        dispatchTable[OP_MARK_STACK_POS]            = &&vm_OP_MARK_STACK_POS;
+        dispatchTable[OP_STORE_PARAM]               = &&vm_OP_STORE_PARAM;
+        dispatchTable[OP_RESTORE_STACK_POS]         = &&vm_OP_RESTORE_STACK_POS;
+        dispatchTable[OP_STORE_ARRAY]               = &&vm_OP_STORE_ARRAY;
+        dispatchTable[OP_STORE_ARRAY_REF]           = &&vm_OP_STORE_ARRAY_REF;
+        dispatchTable[OP_STORE_FIELD_REF]           = &&vm_OP_STORE_FIELD_REF;
+        dispatchTable[OP_STORE_FIELD]               = &&vm_OP_STORE_FIELD;
+        dispatchTable[OP_STORE_FLOAT]               = &&vm_OP_STORE_FLOAT;
+        dispatchTable[OP_STORE_INT0]                = &&vm_OP_STORE_INT0;
+        dispatchTable[OP_STORE_INT1]                = &&vm_OP_STORE_INT1;
+        dispatchTable[OP_STORE_INT2]                = &&vm_OP_STORE_INT2;
+        dispatchTable[OP_STORE_INT3]                = &&vm_OP_STORE_INT3;
+        dispatchTable[OP_STORE_INT4]                = &&vm_OP_STORE_INT4;
+        dispatchTable[OP_STORE_GAME_VAR]            = &&vm_OP_STORE_GAME_VAR;
+        dispatchTable[OP_STORE_GROUP_VAR]           = &&vm_OP_STORE_GROUP_VAR;
+        dispatchTable[OP_STORE_LEVEL_VAR]           = &&vm_OP_STORE_LEVEL_VAR;
+        dispatchTable[OP_STORE_LOCAL_VAR]           = &&vm_OP_STORE_LOCAL_VAR;
+        dispatchTable[OP_STORE_OWNER_VAR]           = &&vm_OP_STORE_OWNER_VAR;
+        dispatchTable[OP_STORE_PARM_VAR]            = &&vm_OP_STORE_PARM_VAR;
+        dispatchTable[OP_STORE_SELF_VAR]            = &&vm_OP_STORE_SELF_VAR;
+        dispatchTable[OP_STORE_GAME]                = &&vm_OP_STORE_GAME;
+        dispatchTable[OP_STORE_GROUP]               = &&vm_OP_STORE_GROUP;
+        dispatchTable[OP_STORE_LEVEL]               = &&vm_OP_STORE_LEVEL;
+        dispatchTable[OP_STORE_LOCAL]               = &&vm_OP_STORE_LOCAL;
+        dispatchTable[OP_STORE_OWNER]               = &&vm_OP_STORE_OWNER;
+        dispatchTable[OP_STORE_PARM]                = &&vm_OP_STORE_PARM;
+        dispatchTable[OP_STORE_SELF]                = &&vm_OP_STORE_SELF;
+        dispatchTable[OP_STORE_NIL]                 = &&vm_OP_STORE_NIL;
+        dispatchTable[OP_STORE_NULL]                = &&vm_OP_STORE_NULL;
+        dispatchTable[OP_STORE_STRING]              = &&vm_OP_STORE_STRING;
+        dispatchTable[OP_STORE_VECTOR]              = &&vm_OP_STORE_VECTOR;
+        dispatchTable[OP_SWITCH]                    = &&vm_OP_SWITCH;
+        dispatchTable[OP_UN_CAST_BOOLEAN]           = &&vm_OP_UN_CAST_BOOLEAN;
+        dispatchTable[OP_UN_COMPLEMENT]             = &&vm_OP_UN_COMPLEMENT;
+        dispatchTable[OP_UN_MINUS]                  = &&vm_OP_UN_MINUS;
+        dispatchTable[OP_UN_DEC]                    = &&vm_OP_UN_DEC;
+        dispatchTable[OP_UN_INC]                    = &&vm_OP_UN_INC;
+        dispatchTable[OP_UN_SIZE]                   = &&vm_OP_UN_SIZE;
+        dispatchTable[OP_UN_TARGETNAME]             = &&vm_OP_UN_TARGETNAME;
+        dispatchTable[OP_VAR_UN_NOT]                = &&vm_OP_VAR_UN_NOT;
+        dispatchTable[OP_DONE]                      = &&vm_OP_DONE;
+        dispatchTable[OP_NOP]                       = &&vm_OP_NOP;
+
+        dispatchTable[OP_UN_INC_LOCAL_VAR]          = &&vm_OP_UN_INC_LOCAL_VAR;
+        dispatchTable[OP_UN_DEC_LOCAL_VAR]          = &&vm_OP_UN_DEC_LOCAL_VAR;
+        dispatchTable[OP_STORE_LOCAL_VAR2]          = &&vm_OP_STORE_LOCAL_VAR2;
+        dispatchTable[OP_EXEC_CMD_METHOD_LOCAL_VAR] = &&vm_OP_EXEC_CMD_METHOD_LOCAL_VAR;
+        dispatchTable[OP_EXEC_METHOD_LOCAL_VAR]     = &&vm_OP_EXEC_METHOD_LOCAL_VAR;
+    }
+#endif
+
+    while (state == STATE_RUNNING) {
+        if (bTraced) {
+            if (!g_scripttrace->integer || !CanScriptTracePrint()) {
+                return;
+            }
+
             switch (g_scripttrace->integer) {
             case 1:
             case 3:
@@ -1079,541 +1322,525 @@ void ScriptVM::Execute(ScriptVariable *data, int dataSize, str label)
 
         m_PrevCodePos = m_CodePos;
 
-        try {
-            if (!m_VMStack.m_bMarkStack) {
-                /*
-				assert(pTop >= localStack && pTop < localStack + localStackSize);
-				if (pTop < localStack)
-				{
-					deleteThread = true;
-					state = STATE_EXECUTION;
-
-					error("VM stack error. Negative stack value %d.\n", pTop - localStack);
-					break;
-				}
-				else if (pTop >= localStack + localStackSize)
-				{
-					deleteThread = true;
-					state = STATE_EXECUTION;
-
-					error("VM stack error. Exceeded the maximum stack size %d.\n", localStackSize);
-					break;
-				}
-				*/
-            }
-
-            opcode = m_CodePos++;
-            switch (*opcode) {
-            case OP_BIN_BITWISE_AND:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        opcode = m_CodePos++;
+        switch (*opcode) {
+        VM_CASE(OP_BIN_BITWISE_AND):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpBitwiseAnd(*b, *a)) {
                 *b &= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_BITWISE_OR:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_BITWISE_OR):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpBitwiseOr(*b, *a)) {
                 *b |= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_BITWISE_EXCL_OR:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_BITWISE_EXCL_OR):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpBitwiseExclOr(*b, *a)) {
                 *b ^= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_EQUALITY:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_EQUALITY):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpEquality(*b, *a, false)) {
                 b->setIntValue(*b == *a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_INEQUALITY:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_INEQUALITY):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpEquality(*b, *a, true)) {
                 b->setIntValue(*b != *a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_GREATER_THAN:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_GREATER_THAN):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpGreaterThan(*b, *a)) {
                 b->greaterthan(*a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_GREATER_THAN_OR_EQUAL:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_GREATER_THAN_OR_EQUAL):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpGreaterThanOrEqual(*b, *a)) {
                 b->greaterthanorequal(*a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_LESS_THAN:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_LESS_THAN):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpLessThan(*b, *a)) {
                 b->lessthan(*a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_LESS_THAN_OR_EQUAL:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_LESS_THAN_OR_EQUAL):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpLessThanOrEqual(*b, *a)) {
                 b->lessthanorequal(*a);
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_PLUS:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_PLUS):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpPlus(*b, *a)) {
                 *b += *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_MINUS:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_MINUS):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpMinus(*b, *a)) {
                 *b -= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_MULTIPLY:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_MULTIPLY):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpMultiply(*b, *a)) {
                 *b *= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_DIVIDE:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_DIVIDE):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpDivide(*b, *a)) {
                 *b /= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_PERCENTAGE:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_PERCENTAGE):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpPercentage(*b, *a)) {
                 *b %= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_SHIFT_LEFT:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_SHIFT_LEFT):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpShiftLeft(*b, *a)) {
                 *b <<= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BIN_SHIFT_RIGHT:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.GetTop();
+        VM_CASE(OP_BIN_SHIFT_RIGHT):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.GetTop();
 
+            if (!FastOpShiftRight(*b, *a)) {
                 *b >>= *a;
-                break;
+            }
+            VM_NEXT();
 
-            case OP_BOOL_JUMP_FALSE4:
-                doJumpIf(!m_VMStack.Pop().m_data.intValue);
-                break;
+        VM_CASE(OP_BOOL_JUMP_FALSE4):
+            doJumpIf(!m_VMStack.Pop().m_data.intValue);
+            VM_NEXT();
 
-            case OP_BOOL_JUMP_TRUE4:
-                doJumpIf(m_VMStack.Pop().m_data.intValue);
-                break;
+        VM_CASE(OP_BOOL_JUMP_TRUE4):
+            doJumpIf(m_VMStack.Pop().m_data.intValue);
+            VM_NEXT();
 
-            case OP_VAR_JUMP_FALSE4:
-                doJumpIf(!m_VMStack.Pop().booleanValue());
-                break;
+        VM_CASE(OP_VAR_JUMP_FALSE4):
+            doJumpIf(!m_VMStack.Pop().booleanValue());
+            VM_NEXT();
 
-            case OP_VAR_JUMP_TRUE4:
-                doJumpIf(m_VMStack.Pop().booleanValue());
-                break;
+        VM_CASE(OP_VAR_JUMP_TRUE4):
+            doJumpIf(m_VMStack.Pop().booleanValue());
+            VM_NEXT();
 
-            case OP_BOOL_LOGICAL_AND:
-                doJumpVarIf(!m_VMStack.GetTop().m_data.intValue);
-                break;
+        VM_CASE(OP_BOOL_LOGICAL_AND):
+            doJumpVarIf(!m_VMStack.GetTop().m_data.intValue);
+            VM_NEXT();
 
-            case OP_BOOL_LOGICAL_OR:
-                doJumpVarIf(m_VMStack.GetTop().m_data.intValue);
-                break;
+        VM_CASE(OP_BOOL_LOGICAL_OR):
+            doJumpVarIf(m_VMStack.GetTop().m_data.intValue);
+            VM_NEXT();
 
-            case OP_VAR_LOGICAL_AND:
-                if (!doJumpVarIf(m_VMStack.GetTop().booleanValue())) {
-                    m_VMStack.GetTop().SetFalse();
-                }
-                break;
+        VM_CASE(OP_VAR_LOGICAL_AND):
+            if (!doJumpVarIf(m_VMStack.GetTop().booleanValue())) {
+                m_VMStack.GetTop().SetFalse();
+            }
+            VM_NEXT();
 
-            case OP_VAR_LOGICAL_OR:
-                if (!doJumpVarIf(!m_VMStack.GetTop().booleanValue())) {
-                    m_VMStack.GetTop().SetTrue();
-                }
-                break;
+        VM_CASE(OP_VAR_LOGICAL_OR):
+            if (!doJumpVarIf(!m_VMStack.GetTop().booleanValue())) {
+                m_VMStack.GetTop().SetTrue();
+            }
+            VM_NEXT();
 
-            case OP_BOOL_STORE_FALSE:
-                m_VMStack.PushAndGet().SetFalse();
-                break;
+        VM_CASE(OP_BOOL_STORE_FALSE):
+            m_VMStack.PushAndGet().SetFalse();
+            VM_NEXT();
 
-            case OP_BOOL_STORE_TRUE:
-                m_VMStack.PushAndGet().SetTrue();
-                break;
+        VM_CASE(OP_BOOL_STORE_TRUE):
+            m_VMStack.PushAndGet().SetTrue();
+            VM_NEXT();
 
-            case OP_BOOL_UN_NOT:
-                m_VMStack.GetTop().m_data.intValue = (m_VMStack.GetTop().m_data.intValue == 0);
-                break;
+        VM_CASE(OP_BOOL_UN_NOT):
+            m_VMStack.GetTop().m_data.intValue = (m_VMStack.GetTop().m_data.intValue == 0);
+            VM_NEXT();
 
-            case OP_CALC_VECTOR:
-                c = &m_VMStack.Pop();
-                b = &m_VMStack.Pop();
-                a = &m_VMStack.GetTop();
+        VM_CASE(OP_CALC_VECTOR):
+            c = &m_VMStack.Pop();
+            b = &m_VMStack.Pop();
+            a = &m_VMStack.GetTop();
 
-                m_VMStack.GetTop().setVectorValue(Vector(a->floatValue(), b->floatValue(), c->floatValue()));
-                break;
+            m_VMStack.GetTop().setVectorValue(Vector(a->floatValue(), b->floatValue(), c->floatValue()));
+            VM_NEXT();
 
-            case OP_EXEC_CMD0:
-                {
-                    execCmdCommon(0);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD0):
+            {
+                execCmdCommon(0);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD1:
-                {
-                    execCmdCommon(1);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD1):
+            {
+                execCmdCommon(1);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD2:
-                {
-                    execCmdCommon(2);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD2):
+            {
+                execCmdCommon(2);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD3:
-                {
-                    execCmdCommon(3);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD3):
+            {
+                execCmdCommon(3);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD4:
-                {
-                    execCmdCommon(4);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD4):
+            {
+                execCmdCommon(4);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD5:
-                {
-                    execCmdCommon(5);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD5):
+            {
+                execCmdCommon(5);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_COUNT1:
-                {
-                    const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
-                    execCmdCommon(numParms);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_COUNT1):
+            {
+                const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
+                execCmdCommon(numParms);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD0:
-                {
-                    execCmdMethodCommon(0);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD0):
+            {
+                execCmdMethodCommon(0);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD1:
-                {
-                    execCmdMethodCommon(1);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD1):
+            {
+                execCmdMethodCommon(1);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD2:
-                {
-                    execCmdMethodCommon(2);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD2):
+            {
+                execCmdMethodCommon(2);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD3:
-                {
-                    execCmdMethodCommon(3);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD3):
+            {
+                execCmdMethodCommon(3);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD4:
-                {
-                    execCmdMethodCommon(4);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD4):
+            {
+                execCmdMethodCommon(4);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD5:
-                {
-                    execCmdMethodCommon(5);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD5):
+            {
+                execCmdMethodCommon(5);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_CMD_METHOD_COUNT1:
-                {
-                    const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
-                    execCmdMethodCommon(numParms);
-                    break;
-                }
+        VM_CASE(OP_EXEC_CMD_METHOD_COUNT1):
+            {
+                const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
+                execCmdMethodCommon(numParms);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD0:
-                {
-                    execMethodCommon(0);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD0):
+            {
+                execMethodCommon(0);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD1:
-                {
-                    execMethodCommon(1);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD1):
+            {
+                execMethodCommon(1);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD2:
-                {
-                    execMethodCommon(2);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD2):
+            {
+                execMethodCommon(2);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD3:
-                {
-                    execMethodCommon(3);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD3):
+            {
+                execMethodCommon(3);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD4:
-                {
-                    execMethodCommon(4);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD4):
+            {
+                execMethodCommon(4);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD5:
-                {
-                    execMethodCommon(5);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD5):
+            {
+                execMethodCommon(5);
+                VM_NEXT();
+            }
 
-            case OP_EXEC_METHOD_COUNT1:
-                {
-                    const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
-                    execMethodCommon(numParms);
-                    break;
-                }
+        VM_CASE(OP_EXEC_METHOD_COUNT1):
+            {
+                const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
+                execMethodCommon(numParms);
+                VM_NEXT();
+            }
 
-            case OP_FUNC:
-                {
-                    execFunction(Director);
-                    break;
-                }
+        VM_CASE(OP_FUNC):
+            {
+                execFunction(Director);
+                VM_CHECK_BUDGET();
+                VM_NEXT();
+            }
 
-            case OP_JUMP4:
-                jump(fetchOpcodeValue<unsigned int>());
-                break;
+        VM_CASE(OP_JUMP4):
+            jump(fetchOpcodeValue<unsigned int>());
+            VM_NEXT();
 
-            case OP_JUMP_BACK4:
-                jumpBack(fetchActualOpcodeValue<unsigned int>());
-                break;
+        VM_CASE(OP_JUMP_BACK4):
+            jumpBack(fetchActualOpcodeValue<unsigned int>());
+            VM_CHECK_BUDGET();
+            VM_NEXT();
 
-            case OP_LOAD_ARRAY_VAR:
-                a = &m_VMStack.Pop();
-                b = &m_VMStack.Pop();
-                c = &m_VMStack.Pop();
+        VM_CASE(OP_LOAD_ARRAY_VAR):
+            a = &m_VMStack.Pop();
+            b = &m_VMStack.Pop();
+            c = &m_VMStack.Pop();
 
-                b->setArrayAt(*a, *c);
-                break;
+            b->setArrayAt(*a, *c);
+            VM_NEXT();
 
-            case OP_LOAD_FIELD_VAR:
-                a = &m_VMStack.Pop();
+        VM_CASE(OP_LOAD_FIELD_VAR):
+            a = &m_VMStack.Pop();
 
+            try {
                 try {
-                    try {
-                        listener = a->listenerValue();
-
-                        if (listener == NULL) {
-                            fieldNameIndex = fetchActualOpcodeValue<op_name_t>();
-                            ScriptError(
-                                "Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str()
-                            );
-                        }
-                    } catch (...) {
-                        skipField();
-                        throw;
-                    }
+                    listener = a->listenerValue();
 
-                    loadTop(listener);
+                    if (listener == NULL) {
+                        fieldNameIndex = fetchActualOpcodeValue<op_name_t>();
+                        ScriptError(
+                            "Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str()
+                        );
+                    }
                 } catch (...) {
-                    m_VMStack.Pop();
+                    skipField();
                     throw;
                 }
 
-                break;
+                loadTop(listener);
+            } catch (...) {
+                m_VMStack.Pop();
+                throw;
+            }
 
-            case OP_LOAD_CONST_ARRAY1:
-                {
-                    op_arrayParmNum_t numParms = fetchOpcodeValue<op_arrayParmNum_t>();
+            VM_NEXT();
 
-                    ScriptVariable& pTop = m_VMStack.PopAndGet(numParms - 1);
-                    pTop.setConstArrayValue(&pTop, numParms);
-                    break;
-                }
+        VM_CASE(OP_LOAD_CONST_ARRAY1):
+            {
+                op_arrayParmNum_t numParms = fetchOpcodeValue<op_arrayParmNum_t>();
 
-            case OP_LOAD_GAME_VAR:
-                loadTop(&game);
-                break;
+                ScriptVariable& pTop = m_VMStack.PopAndGet(numParms - 1);
+                pTop.setConstArrayValue(&pTop, numParms);
+                VM_NEXT();
+            }
 
-            case OP_LOAD_GROUP_VAR:
-                loadTop(m_ScriptClass);
-                break;
+        VM_CASE(OP_LOAD_GAME_VAR):
+            loadTop(&game);
+            VM_NEXT();
 
-            case OP_LOAD_LEVEL_VAR:
-                loadTop(&level);
-                break;
+        VM_CASE(OP_LOAD_GROUP_VAR):
+            loadTop(m_ScriptClass);
+            VM_NEXT();
 
-            case OP_LOAD_LOCAL_VAR:
-                loadTop(m_Thread);
-                break;
+        VM_CASE(OP_LOAD_LEVEL_VAR):
+            loadTop(&level);
+            VM_NEXT();
 
-            case OP_LOAD_OWNER_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_VMStack.Pop();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
-                }
+        VM_CASE(OP_LOAD_LOCAL_VAR):
+            loadTop(m_Thread);
+            VM_NEXT();
 
-                if (!m_ScriptClass->m_Self->GetScriptOwner()) {
-                    m_VMStack.Pop();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self.owner is NULL");
-                }
+        VM_CASE(OP_LOAD_OWNER_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_VMStack.Pop();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-                loadTop(m_ScriptClass->m_Self->GetScriptOwner());
-                break;
+            if (!m_ScriptClass->m_Self->GetScriptOwner()) {
+                m_VMStack.Pop();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self.owner is NULL");
+            }
 
-            case OP_LOAD_PARM_VAR:
-                loadTop(&parm);
-                break;
+            loadTop(m_ScriptClass->m_Self->GetScriptOwner());
+            VM_NEXT();
 
-            case OP_LOAD_SELF_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_VMStack.Pop();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
-                }
+        VM_CASE(OP_LOAD_PARM_VAR):
+            loadTop(&parm);
+            VM_NEXT();
 
-                loadTop(m_ScriptClass->m_Self);
-                break;
-
-            case OP_LOAD_STORE_GAME_VAR:
-                loadStoreTop(&game);
-                break;
+        VM_CASE(OP_LOAD_SELF_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_VMStack.Pop();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-            case OP_LOAD_STORE_GROUP_VAR:
-                loadStoreTop(m_ScriptClass);
-                break;
+            loadTop(m_ScriptClass->m_Self);
+            VM_NEXT();
 
-            case OP_LOAD_STORE_LEVEL_VAR:
-                loadStoreTop(&level);
-                break;
+        VM_CASE(OP_LOAD_STORE_GAME_VAR):
+            loadStoreTop(&game);
+            VM_NEXT();
 
-            case OP_LOAD_STORE_LOCAL_VAR:
-                loadStoreTop(m_Thread);
-                break;
+        VM_CASE(OP_LOAD_STORE_GROUP_VAR):
+            loadStoreTop(m_ScriptClass);
+            VM_NEXT();
 
-            case OP_LOAD_STORE_OWNER_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
-                }
+        VM_CASE(OP_LOAD_STORE_LEVEL_VAR):
+            loadStoreTop(&level);
+            VM_NEXT();
 
-                if (!m_ScriptClass->m_Self->GetScriptOwner()) {
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self.owner is NULL");
-                }
+        VM_CASE(OP_LOAD_STORE_LOCAL_VAR):
+            loadStoreTop(m_Thread);
+            VM_NEXT();
 
-                loadStoreTop(m_ScriptClass->m_Self->GetScriptOwner());
-                break;
+        VM_CASE(OP_LOAD_STORE_OWNER_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-            case OP_LOAD_STORE_PARM_VAR:
-                loadStoreTop(&parm);
-                break;
+            if (!m_ScriptClass->m_Self->GetScriptOwner()) {
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self.owner is NULL");
+            }
 
-            case OP_LOAD_STORE_SELF_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
-                }
+            loadStoreTop(m_ScriptClass->m_Self->GetScriptOwner());
+            VM_NEXT();
 
-                loadStoreTop(m_ScriptClass->m_Self);
-                break;
+        VM_CASE(OP_LOAD_STORE_PARM_VAR):
+            loadStoreTop(&parm);
+            VM_NEXT();
 
-            case OP_MARK_STACK_POS:
-                m_StackPos             = &m_VMStack.GetTop();
-                m_VMStack.m_bMarkStack = true;
-                break;
+        VM_CASE(OP_LOAD_STORE_SELF_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-            case OP_STORE_PARAM:
-                if (fastEvent.dataSize) {
-                    m_VMStack.SetTop(*(fastEvent.data++));
-                    fastEvent.dataSize--;
-                } else {
-                    m_VMStack.SetTop(*(m_StackPos + 1));
-                    m_VMStack.GetTop().Clear();
-                }
-                break;
+            loadStoreTop(m_ScriptClass->m_Self);
+            VM_NEXT();
 
-            case OP_RESTORE_STACK_POS:
-                m_VMStack.SetTop(*m_StackPos);
-                m_VMStack.m_bMarkStack = false;
-                break;
+        VM_CASE(OP_MARK_STACK_POS):
+            m_StackPos             = &m_VMStack.GetTop();
+            m_VMStack.m_bMarkStack = true;
+            VM_NEXT();
 
-            case OP_STORE_ARRAY:
-                m_VMStack.Pop();
-                m_VMStack.GetTop().evalArrayAt(*(m_VMStack.GetTopPtr() + 1));
-                break;
-
-            case OP_STORE_ARRAY_REF:
-                m_VMStack.Pop();
-                m_VMStack.GetTop().setArrayRefValue(*(m_VMStack.GetTopPtr() + 1));
-                break;
+        VM_CASE(OP_STORE_PARAM):
+            if (fastEvent.dataSize) {
+                m_VMStack.SetTop(*(fastEvent.data++));
+                fastEvent.dataSize--;
+            } else {
+                m_VMStack.SetTop(*(m_StackPos + 1));
+                m_VMStack.GetTop().Clear();
+            }
+            VM_NEXT();
 
-            case OP_STORE_FIELD_REF:
-                try {
-                    try {
-                        listener = m_VMStack.GetTop().listenerValue();
-
-                        if (listener == nullptr) {
-                            fieldNameIndex = fetchActualOpcodeValue<op_name_t>();
-                            ScriptError(
-                                "Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str()
-                            );
-                        }
-                    } catch (...) {
-                        skipField();
-                        m_VMStack.GetTop().Clear();
-                        throw;
-                    }
+        VM_CASE(OP_RESTORE_STACK_POS):
+            m_VMStack.SetTop(*m_StackPos);
+            m_VMStack.m_bMarkStack = false;
+            VM_NEXT();
 
-                    ScriptVariable *const listenerVar = storeTop<true>(listener);
+        VM_CASE(OP_STORE_ARRAY):
+            m_VMStack.Pop();
+            m_VMStack.GetTop().evalArrayAt(*(m_VMStack.GetTopPtr() + 1));
+            VM_NEXT();
 
-                    if (listenerVar) {
-                        // having a listener variable means the variable was just created
-                        m_VMStack.GetTop().setRefValue(listenerVar);
-                    }
-                    break;
-                } catch (...) {
-                    ScriptVariable *const pTop = m_VMStack.GetTopPtr();
-                    pTop->setRefValue(pTop);
-                    throw;
-                }
+        VM_CASE(OP_STORE_ARRAY_REF):
+            m_VMStack.Pop();
+            m_VMStack.GetTop().setArrayRefValue(*(m_VMStack.GetTopPtr() + 1));
+            VM_NEXT();
 
-            case OP_STORE_FIELD:
+        VM_CASE(OP_STORE_FIELD_REF):
+            try {
                 try {
                     listener = m_VMStack.GetTop().listenerValue();
 
                     if (listener == nullptr) {
                         fieldNameIndex = fetchActualOpcodeValue<op_name_t>();
-                        ScriptError("Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str());
+                        ScriptError(
+                            "Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str()
+                        );
                     }
                 } catch (...) {
                     skipField();
@@ -1621,289 +1848,327 @@ void ScriptVM::Execute(ScriptVariable *data, int dataSize, str label)
                     throw;
                 }
 
-                storeTop<true>(listener);
-                break;
-
-            case OP_STORE_FLOAT:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setFloatValue(fetchOpcodeValue<float>());
-                break;
-
-            case OP_STORE_INT0:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setIntValue(0);
-                break;
-
-            case OP_STORE_INT1:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setIntValue(fetchOpcodeValue<byte>());
-                break;
-
-            case OP_STORE_INT2:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setIntValue(fetchOpcodeValue<short>());
-                break;
-
-            case OP_STORE_INT3:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setIntValue(fetchOpcodeValue<short3>());
-                break;
-
-            case OP_STORE_INT4:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setIntValue(fetchOpcodeValue<int>());
-                break;
-
-            case OP_STORE_GAME_VAR:
-                storeTop(&game);
-                break;
-
-            case OP_STORE_GROUP_VAR:
-                storeTop(m_ScriptClass);
-                break;
+                ScriptVariable *const listenerVar = storeTop<true>(listener);
 
-            case OP_STORE_LEVEL_VAR:
-                storeTop(&level);
-                break;
-
-            case OP_STORE_LOCAL_VAR:
-                storeTop(m_Thread);
-                break;
-
-            case OP_STORE_OWNER_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_VMStack.PushAndGet().Clear();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
-                }
-
-                if (!m_ScriptClass->m_Self->GetScriptOwner()) {
-                    m_VMStack.PushAndGet().Clear();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self.owner is NULL");
+                if (listenerVar) {
+                    // having a listener variable means the variable was just created
+                    m_VMStack.GetTop().setRefValue(listenerVar);
                 }
+                VM_NEXT();
+            } catch (...) {
+                ScriptVariable *const pTop = m_VMStack.GetTopPtr();
+                pTop->setRefValue(pTop);
+                throw;
+            }
 
-                storeTop(m_ScriptClass->m_Self->GetScriptOwner());
-                break;
+        VM_CASE(OP_STORE_FIELD):
+            try {
+                listener = m_VMStack.GetTop().listenerValue();
 
-            case OP_STORE_PARM_VAR:
-                storeTop(&parm);
-                break;
-
-            case OP_STORE_SELF_VAR:
-                if (!m_ScriptClass->m_Self) {
-                    m_VMStack.PushAndGet().Clear();
-                    m_CodePos += sizeof(unsigned int);
-                    ScriptError("self is NULL");
+                if (listener == nullptr) {
+                    fieldNameIndex = fetchActualOpcodeValue<op_name_t>();
+                    ScriptError("Field '%s' applied to NULL listener", Director.GetString(fieldNameIndex).c_str());
                 }
+            } catch (...) {
+                skipField();
+                m_VMStack.GetTop().Clear();
+                throw;
+            }
 
-                storeTop(m_ScriptClass->m_Self);
-                break;
+            storeTop<true>(listener);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_FLOAT):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setFloatValue(fetchOpcodeValue<float>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_INT0):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setIntValue(0);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_INT1):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setIntValue(fetchOpcodeValue<byte>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_INT2):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setIntValue(fetchOpcodeValue<short>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_INT3):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setIntValue(fetchOpcodeValue<short3>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_INT4):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setIntValue(fetchOpcodeValue<int>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_GAME_VAR):
+            storeTop(&game);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_GROUP_VAR):
+            storeTop(m_ScriptClass);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_LEVEL_VAR):
+            storeTop(&level);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_LOCAL_VAR):
+            storeTop(m_Thread);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_OWNER_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_VMStack.PushAndGet().Clear();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-            case OP_STORE_GAME:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(&game);
-                break;
+            if (!m_ScriptClass->m_Self->GetScriptOwner()) {
+                m_VMStack.PushAndGet().Clear();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self.owner is NULL");
+            }
 
-            case OP_STORE_GROUP:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(m_ScriptClass);
-                break;
+            storeTop(m_ScriptClass->m_Self->GetScriptOwner());
+            VM_NEXT();
 
-            case OP_STORE_LEVEL:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(&level);
-                break;
+        VM_CASE(OP_STORE_PARM_VAR):
+            storeTop(&parm);
+            VM_NEXT();
 
-            case OP_STORE_LOCAL:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(m_Thread);
-                break;
+        VM_CASE(OP_STORE_SELF_VAR):
+            if (!m_ScriptClass->m_Self) {
+                m_VMStack.PushAndGet().Clear();
+                m_CodePos += sizeof(unsigned int);
+                ScriptError("self is NULL");
+            }
 
-            case OP_STORE_OWNER:
-                if (m_ScriptClass->m_Self) {
-                    m_VMStack.Push();
-                } else {
-                    m_VMStack.PushAndGet().Clear();
-                    ScriptError("self is NULL");
-                }
+            storeTop(m_ScriptClass->m_Self);
+            VM_NEXT();
 
-                m_VMStack.GetTop().setListenerValue(m_ScriptClass->m_Self->GetScriptOwner());
-                break;
+        VM_CASE(OP_STORE_GAME):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(&game);
+            VM_NEXT();
 
-            case OP_STORE_PARM:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(&parm);
-                break;
+        VM_CASE(OP_STORE_GROUP):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(m_ScriptClass);
+            VM_NEXT();
 
-            case OP_STORE_SELF:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(m_ScriptClass->m_Self);
-                break;
+        VM_CASE(OP_STORE_LEVEL):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(&level);
+            VM_NEXT();
 
-            case OP_STORE_NIL:
-                m_VMStack.Push();
-                m_VMStack.GetTop().Clear();
-                break;
+        VM_CASE(OP_STORE_LOCAL):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(m_Thread);
+            VM_NEXT();
 
-            case OP_STORE_NULL:
+        VM_CASE(OP_STORE_OWNER):
+            if (m_ScriptClass->m_Self) {
                 m_VMStack.Push();
-                m_VMStack.GetTop().setListenerValue(NULL);
-                break;
+            } else {
+                m_VMStack.PushAndGet().Clear();
+                ScriptError("self is NULL");
+            }
 
-            case OP_STORE_STRING:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setConstStringValue(fetchOpcodeValue<unsigned int>());
-                break;
+            m_VMStack.GetTop().setListenerValue(m_ScriptClass->m_Self->GetScriptOwner());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_PARM):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(&parm);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_SELF):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(m_ScriptClass->m_Self);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_NIL):
+            m_VMStack.Push();
+            m_VMStack.GetTop().Clear();
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_NULL):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setListenerValue(NULL);
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_STRING):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setConstStringValue(fetchOpcodeValue<unsigned int>());
+            VM_NEXT();
+
+        VM_CASE(OP_STORE_VECTOR):
+            m_VMStack.Push();
+            m_VMStack.GetTop().setVectorValue(fetchOpcodeValue<Vector>());
+            VM_NEXT();
+
+        VM_CASE(OP_SWITCH):
+            if (!Switch(fetchActualOpcodeValue<StateScript *>(), m_VMStack.Pop())) {
+                m_CodePos += sizeof(StateScript *);
+            }
+            VM_NEXT();
+
+        VM_CASE(OP_UN_CAST_BOOLEAN):
+            m_VMStack.GetTop().CastBoolean();
+            VM_NEXT();
+
+        VM_CASE(OP_UN_COMPLEMENT):
+            m_VMStack.GetTop().complement();
+            VM_NEXT();
+
+        VM_CASE(OP_UN_MINUS):
+            m_VMStack.GetTop().minus();
+            VM_NEXT();
+
+        VM_CASE(OP_UN_DEC):
+            m_VMStack.GetTop()--;
+            VM_NEXT();
+
+        VM_CASE(OP_UN_INC):
+            m_VMStack.GetTop()++;
+            VM_NEXT();
+
+        VM_CASE(OP_UN_SIZE):
+            m_VMStack.GetTop().setIntValue((int)m_VMStack.GetTop().size());
+            VM_NEXT();
+
+        VM_CASE(OP_UN_TARGETNAME):
+            // retrieve the target name
+            if (world) {
+                targetList = world->GetExistingTargetList(m_VMStack.GetTop().stringValue());
+            } else {
+                // Added in OPM
+                //  don't use the target list if the world is NULL
+                targetList = NULL;
+            }
 
-            case OP_STORE_VECTOR:
-                m_VMStack.Push();
-                m_VMStack.GetTop().setVectorValue(fetchOpcodeValue<Vector>());
-                break;
+            if (!targetList || !targetList->list.NumObjects()) {
+                str targetname = m_VMStack.GetTop().stringValue();
+                // the target name was not found
+                m_VMStack.GetTop().setListenerValue(NULL);
 
-            case OP_SWITCH:
-                if (!Switch(fetchActualOpcodeValue<StateScript *>(), m_VMStack.Pop())) {
-                    m_CodePos += sizeof(StateScript *);
+                if ((*m_PrevCodePos >= OP_BIN_EQUALITY && *m_PrevCodePos <= OP_BIN_GREATER_THAN_OR_EQUAL)
+                    || (*m_PrevCodePos >= OP_BOOL_UN_NOT && *m_PrevCodePos <= OP_UN_CAST_BOOLEAN)) {
+                    ScriptError("Targetname '%s' does not exist.", targetname.c_str());
                 }
-                break;
-
-            case OP_UN_CAST_BOOLEAN:
-                m_VMStack.GetTop().CastBoolean();
-                break;
-
-            case OP_UN_COMPLEMENT:
-                m_VMStack.GetTop().complement();
-                break;
+            } else if (targetList->list.NumObjects() == 1) {
+                // single listener
+                m_VMStack.GetTop().setListenerValue(targetList->list.ObjectAt(1));
+            } else if (targetList->list.NumObjects() > 1) {
+                // multiple listeners
+                m_VMStack.GetTop().setContainerValue((Container<SafePtr<Listener>> *)&targetList->list);
+            }
+            VM_NEXT();
 
-            case OP_UN_MINUS:
-                m_VMStack.GetTop().minus();
-                break;
+        VM_CASE(OP_VAR_UN_NOT):
+            m_VMStack.GetTop().setIntValue(m_VMStack.GetTop().booleanValue());
+            VM_NEXT();
 
-            case OP_UN_DEC:
-                m_VMStack.GetTop()--;
-                break;
+        VM_CASE(OP_DONE):
+            End();
+            VM_NEXT();
 
-            case OP_UN_INC:
-                m_VMStack.GetTop()++;
-                break;
+        VM_CASE(OP_NOP):
+            VM_NEXT();
 
-            case OP_UN_SIZE:
-                m_VMStack.GetTop().setIntValue((int)m_VMStack.GetTop().size());
-                break;
+        //
+        // Superinstructions, the compiler only fuses local variables without getter or setter
+        //
+        VM_CASE(OP_UN_INC_LOCAL_VAR):
+            (*m_Thread->Vars()->GetOrCreateVariable(fetchOpcodeValue<op_name_t>()))++;
+            VM_NEXT();
 
-            case OP_UN_TARGETNAME:
-                // retrieve the target name
-                if (world) {
-                    targetList = world->GetExistingTargetList(m_VMStack.GetTop().stringValue());
-                } else {
-                    // Added in OPM
-                    //  don't use the target list if the world is NULL
-                    targetList = NULL;
-                }
-
-                if (!targetList || !targetList->list.NumObjects()) {
-                    str targetname = m_VMStack.GetTop().stringValue();
-                    // the target name was not found
-                    m_VMStack.GetTop().setListenerValue(NULL);
+        VM_CASE(OP_UN_DEC_LOCAL_VAR):
+            (*m_Thread->Vars()->GetOrCreateVariable(fetchOpcodeValue<op_name_t>()))--;
+            VM_NEXT();
 
-                    if ((*m_PrevCodePos >= OP_BIN_EQUALITY && *m_PrevCodePos <= OP_BIN_GREATER_THAN_OR_EQUAL)
-                        || (*m_PrevCodePos >= OP_BOOL_UN_NOT && *m_PrevCodePos <= OP_UN_CAST_BOOLEAN)) {
-                        ScriptError("Targetname '%s' does not exist.", targetname.c_str());
-                    }
-                } else if (targetList->list.NumObjects() == 1) {
-                    // single listener
-                    m_VMStack.GetTop().setListenerValue(targetList->list.ObjectAt(1));
-                } else if (targetList->list.NumObjects() > 1) {
-                    // multiple listeners
-                    m_VMStack.GetTop().setContainerValue((Container<SafePtr<Listener>> *)&targetList->list);
-                }
-                break;
+        VM_CASE(OP_STORE_LOCAL_VAR2):
+            storeTop(m_Thread);
+            storeTop(m_Thread);
+            VM_NEXT();
 
-            case OP_VAR_UN_NOT:
-                m_VMStack.GetTop().setIntValue(m_VMStack.GetTop().booleanValue());
-                break;
+        VM_CASE(OP_EXEC_CMD_METHOD_LOCAL_VAR):
+            {
+                storeTop(m_Thread);
 
-            case OP_DONE:
-                End();
-                break;
+                const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
+                execCmdMethodCommon(numParms);
+                VM_NEXT();
+            }
 
-            case OP_NOP:
-                break;
+        VM_CASE(OP_EXEC_METHOD_LOCAL_VAR):
+            {
+                storeTop(m_Thread);
 
-            default:
-                assert(!"Invalid opcode");
-                if (*opcode < OP_MAX) {
-                    gi.DPrintf("unknown opcode %d ('%s')\n", *opcode, OpcodeName(*opcode));
-                } else {
-                    gi.DPrintf("unknown opcode %d\n", *opcode);
-                }
-                break;
+                const op_parmNum_t numParms = fetchOpcodeValue<op_parmNum_t>();
+                execMethodCommon(numParms);
+                VM_NEXT();
             }
 
-            Director.cmdCount++;
+        default:
+#ifdef SCRIPTVM_COMPUTED_GOTO
+        vm_default:
+#endif
+            assert(!"Invalid opcode");
+            if (*opcode < OP_MAX) {
+                gi.DPrintf("unknown opcode %d ('%s')\n", *opcode, OpcodeName(*opcode));
+            } else {
+                gi.DPrintf("unknown opcode %d\n", *opcode);
+            }
+            VM_NEXT();
+        }
 
-            if (Director.cmdCount >= 15000) {
-                if (!Director.cmdTime) {
-                    Director.cmdTime  = gi.Milliseconds();
-                    Director.cmdCount = 0;
-                    continue;
-                }
+        Director.cmdCount++;
 
-                if (gi.Milliseconds() - Director.cmdTime < Director.maxTime) {
-                    Director.cmdCount = 0;
-                    continue;
-                }
+        if (Director.cmdCount >= SCRIPTVM_COMMANDS_PER_CHECK) {
+            if (!Director.cmdTime) {
+                Director.cmdTime  = gi.Milliseconds();
+                Director.cmdCount = 0;
+                continue;
+            }
 
-                // The maximum execution time was reached
-                if (level.m_LoopProtection) {
-                    Director.cmdTime = gi.Milliseconds();
+            if (gi.Milliseconds() - Director.cmdTime < Director.maxTime) {
+                Director.cmdCount = 0;
+                continue;
+            }
 
-                    GetScript()->PrintSourcePos(m_CodePos, true);
-                    gi.DPrintf2("\n");
+            // The maximum execution time was reached
+            if (level.m_LoopProtection) {
+                Director.cmdTime = gi.Milliseconds();
 
-                    state = STATE_EXECUTION;
+                GetScript()->PrintSourcePos(m_CodePos, true);
+                gi.DPrintf2("\n");
 
-                    if (level.m_LoopDrop) {
-                        ScriptException::next_abort = -1;
-                    }
+                state = STATE_EXECUTION;
 
-                    ScriptError("Command overflow. Possible infinite loop in thread.\n");
-                    break;
+                if (level.m_LoopDrop) {
+                    ScriptException::next_abort = -1;
                 }
 
-                VM_DPrintf("Update of script position - This is not an error.\n");
-                VM_DPrintf("=================================================\n");
-                m_ScriptClass->GetScript()->PrintSourcePos(opcode, true);
-                VM_DPrintf("=================================================\n");
-
-                Director.cmdCount = 0;
+                ScriptError("Command overflow. Possible infinite loop in thread.\n");
+                break;
             }
-        } catch (ScriptException& exc) {
-            HandleScriptException(exc);
-        }
-    }
-
-    Director.stackCount--;
 
-    if (g_scripttrace->integer && CanScriptTracePrint()) {
-        gi.DPrintf2(
-            "---FRAME: %i (%p) -------------------------------------------------------------------\n",
-            Director.stackCount,
-            this
-        );
-    }
+            VM_DPrintf("Update of script position - This is not an error.\n");
+            VM_DPrintf("=================================================\n");
+            m_ScriptClass->GetScript()->PrintSourcePos(opcode, true);
+            VM_DPrintf("=================================================\n");
 
-    switch (state) {
-    case STATE_WAITING:
-        delete m_Thread;
-        delete this;
-        break;
-    case STATE_SUSPENDED:
-        state = STATE_EXECUTION;
-        break;
-    case STATE_DESTROYED:
-        delete this;
-        break;
+            Director.cmdCount = 0;
+        }
     }
 }
 
@@ -195,6 +195,9 @@ private:
     unsigned char *ProgBuffer();
     void           HandleScriptException(ScriptException& exc);
 
+    template<bool bTraced>
+    void ExecuteOpcodes();
+
 public:
     void *operator new(size_t size);
     void  operator delete(void *ptr);
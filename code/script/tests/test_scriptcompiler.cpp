@@ -0,0 +1,242 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks that separate script compilers parse and compile scripts in turn,
+// like the scripts of the next maps being precompiled between the scripts of the current map,
+// and that each program is the same as when its script is compiled alone.
+// Uses the lexer and the parser generated by flex and bison.
+//
+
+#include "../../fgame/g_local.h"
+#include "../../fgame/gamescript.h"
+#include "../../fgame/scriptmaster.h"
+#include "../scriptcompiler.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static const char *scriptA = "// first script\n"
+                             "main:\n"
+                             "    local.count = 1\n"
+                             "    local.text = \"count \" + local.count\n"
+                             "    if (local.count == 1 && level.started != NIL) {\n"
+                             "        thread second local.text\n"
+                             "    }\n"
+                             "end\n"
+                             "\n"
+                             "second local.text:\n"
+                             "    for (local.i = 0; local.i < 4; local.i++) {\n"
+                             "        local.text += local.i\n"
+                             "    }\n"
+                             "    level.text = local.text\n"
+                             "end\n";
+
+// no switch, its opcode holds a pointer to the labels of the script it belongs to
+static const char *scriptB = "main:\n"
+                             "    /* vectors, arrays and loops\n"
+                             "       in the second script */\n"
+                             "    local.origin = ( 1 2 -3.5 )\n"
+                             "    local.names = first::second::third\n"
+                             "    if (local.names.size == 3) {\n"
+                             "        level.name = local.names[2]\n"
+                             "    } else {\n"
+                             "        level.name = \"none\"\n"
+                             "    }\n"
+                             "    while (local.origin[2] < 0) {\n"
+                             "        local.origin[2] += 1.5\n"
+                             "    }\n"
+                             "end\n";
+
+//
+// Engine functions used by the compiler
+//
+static void *Test_Malloc(size_t size)
+{
+    return calloc(1, size);
+}
+
+static void Test_Free(void *ptr)
+{
+    free(ptr);
+}
+
+static void Test_Printf(const char *format, ...)
+{
+    va_list va;
+
+    va_start(va, format);
+    vprintf(format, va);
+    va_end(va);
+}
+
+static void Test_Error(int level, const char *format, ...)
+{
+    va_list va;
+
+    va_start(va, format);
+    vfprintf(stderr, format, va);
+    va_end(va);
+
+    exit(1);
+}
+
+static cvar_t *Test_Cvar_Get(const char *varName, const char *varValue, int varFlags)
+{
+    cvar_t *cvar = (cvar_t *)calloc(1, sizeof(cvar_t));
+
+    cvar->name    = (char *)varName;
+    cvar->string  = (char *)varValue;
+    cvar->integer = atoi(varValue);
+    cvar->value   = atof(varValue);
+    return cvar;
+}
+
+static void Test_Cvar_Set(const char *varName, const char *varValue) {}
+
+struct compiledProgram_t {
+    unsigned char *buffer;
+    size_t         length;
+    int            requiredStackSize;
+};
+
+static void LoadScript(GameScript *scr, const char *source)
+{
+    scr->LoadSource(source, strlen(source));
+}
+
+static bool ParseScript(ScriptCompiler& compiler, GameScript *scr, size_t& nodeLength)
+{
+    compiler.Reset();
+    return compiler.Parse(scr, compiler.Preprocess(scr->m_SourceBuffer), "script", nodeLength);
+}
+
+static bool CompileScript(ScriptCompiler& compiler, GameScript *scr, size_t nodeLength, compiledProgram_t& program)
+{
+    program.buffer = (unsigned char *)gi.Malloc(nodeLength);
+    if (!compiler.Compile(scr, program.buffer, program.length)) {
+        return false;
+    }
+
+    program.requiredStackSize =
+        compiler.m_iInternalMaxVarStackOffset + 9 * compiler.m_iMaxExternalVarStackOffset + 1;
+    return true;
+}
+
+static bool SameProgram(const compiledProgram_t& a, const compiledProgram_t& b)
+{
+    return a.length == b.length && a.requiredStackSize == b.requiredStackSize
+        && !memcmp(a.buffer, b.buffer, a.length);
+}
+
+#define CHECK(condition)                                                     \
+    if (!(condition)) {                                                      \
+        std::cerr << __FUNCTION__ << ": failed " << #condition << std::endl; \
+        return false;                                                        \
+    }
+
+bool test_compilers_in_turn()
+{
+    ScriptCompiler    first;
+    ScriptCompiler    second;
+    GameScript        aloneA("maps/a.scr");
+    GameScript        aloneB("maps/b.scr");
+    GameScript        turnA("maps/a.scr");
+    GameScript        turnB("maps/b.scr");
+    compiledProgram_t programAloneA;
+    compiledProgram_t programAloneB;
+    compiledProgram_t programA;
+    compiledProgram_t programB;
+    compiledProgram_t programAgain;
+    size_t            lengthA;
+    size_t            lengthB;
+
+    LoadScript(&aloneA, scriptA);
+    LoadScript(&aloneB, scriptB);
+    LoadScript(&turnA, scriptA);
+    LoadScript(&turnB, scriptB);
+
+    // each script compiled alone
+    CHECK(ParseScript(first, &aloneA, lengthA));
+    CHECK(lengthA > 0);
+    CHECK(CompileScript(first, &aloneA, lengthA, programAloneA));
+
+    CHECK(ParseScript(first, &aloneB, lengthB));
+    CHECK(lengthB > 0);
+    CHECK(CompileScript(first, &aloneB, lengthB, programAloneB));
+
+    // the second compiler parses its script while the first one still holds its parse tree
+    CHECK(ParseScript(first, &turnA, lengthA));
+    CHECK(ParseScript(second, &turnB, lengthB));
+    CHECK(CompileScript(second, &turnB, lengthB, programB));
+    CHECK(CompileScript(first, &turnA, lengthA, programA));
+
+    CHECK(SameProgram(programA, programAloneA));
+    CHECK(SameProgram(programB, programAloneB));
+
+    // a script that fails to parse leaves the other compiler working
+    GameScript broken("maps/broken.scr");
+    GameScript again("maps/b.scr");
+    size_t     brokenLength;
+
+    LoadScript(&broken, "main:\n    if (local.a {\nend\n");
+    LoadScript(&again, scriptB);
+
+    CHECK(ParseScript(first, &again, lengthB));
+    CHECK(!ParseScript(second, &broken, brokenLength));
+    CHECK(CompileScript(first, &again, lengthB, programAgain));
+    CHECK(SameProgram(programAgain, programAloneB));
+
+    gi.Free(programAloneA.buffer);
+    gi.Free(programAloneB.buffer);
+    gi.Free(programA.buffer);
+    gi.Free(programB.buffer);
+    gi.Free(programAgain.buffer);
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    gi.Malloc      = Test_Malloc;
+    gi.Free        = Test_Free;
+    gi.Printf      = Test_Printf;
+    gi.DPrintf     = Test_Printf;
+    gi.DPrintf2    = Test_Printf;
+    gi.DebugPrintf = Test_Printf;
+    gi.Error       = Test_Error;
+    gi.Cvar_Get    = Test_Cvar_Get;
+    gi.cvar_set    = Test_Cvar_Set;
+
+    CVAR_Init();
+    L_InitEvents();
+    Director.Reset(false);
+
+    if (!test_compilers_in_turn()) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,309 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks that the fast paths of the script binary operators give bit-identical results
+// to the ScriptVariable operators for every pair of operand types they handle.
+//
+
+#include "../scriptvariable.h"
+#include "../scriptexception.h"
+#include "../scriptfastops.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Debug builds define Z_Malloc as a macro that forwards to Z_MallocDebug
+#ifdef ZONE_DEBUG
+void *Z_MallocDebug(int size, const char *label, const char *file, int line)
+{
+    return calloc(1, size);
+}
+#else
+void *Z_Malloc(int size)
+{
+    return calloc(1, size);
+}
+#endif
+
+void Z_Free(void *ptr)
+{
+    free(ptr);
+}
+
+//
+// Engine functions referenced by the script system
+//
+cvar_t *developer;
+
+cvar_t *Cvar_Get(const char *var_name, const char *var_value, int flags)
+{
+    static cvar_t cvar;
+    return &cvar;
+}
+
+size_t FS_Write(const void *buffer, size_t len, fileHandle_t f)
+{
+    return 0;
+}
+
+fileHandle_t FS_FOpenFileWrite_HomeData(const char *filename)
+{
+    return 0;
+}
+
+void FS_FCloseFile(fileHandle_t f) {}
+
+long FS_ReadFile(const char *qpath, void **buffer)
+{
+    return -1;
+}
+
+void FS_FreeFile(void *buffer) {}
+
+typedef bool (*fastop_t)(ScriptVariable& b, const ScriptVariable& a);
+typedef void (*op_t)(ScriptVariable& b, ScriptVariable& a);
+
+//
+// The operations below are done the way the VM does when the fast path returns false
+//
+static void OpPlus(ScriptVariable& b, ScriptVariable& a)
+{
+    b += a;
+}
+
+static void OpMinus(ScriptVariable& b, ScriptVariable& a)
+{
+    b -= a;
+}
+
+static void OpMultiply(ScriptVariable& b, ScriptVariable& a)
+{
+    b *= a;
+}
+
+static void OpDivide(ScriptVariable& b, ScriptVariable& a)
+{
+    b /= a;
+}
+
+static void OpPercentage(ScriptVariable& b, ScriptVariable& a)
+{
+    b %= a;
+}
+
+static void OpBitwiseAnd(ScriptVariable& b, ScriptVariable& a)
+{
+    b &= a;
+}
+
+static void OpBitwiseOr(ScriptVariable& b, ScriptVariable& a)
+{
+    b |= a;
+}
+
+static void OpBitwiseExclOr(ScriptVariable& b, ScriptVariable& a)
+{
+    b ^= a;
+}
+
+static void OpShiftLeft(ScriptVariable& b, ScriptVariable& a)
+{
+    b <<= a;
+}
+
+static void OpShiftRight(ScriptVariable& b, ScriptVariable& a)
+{
+    b >>= a;
+}
+
+static void OpEquality(ScriptVariable& b, ScriptVariable& a)
+{
+    b.setIntValue(b == a);
+}
+
+static void OpInequality(ScriptVariable& b, ScriptVariable& a)
+{
+    b.setIntValue(b != a);
+}
+
+static void OpGreaterThan(ScriptVariable& b, ScriptVariable& a)
+{
+    b.greaterthan(a);
+}
+
+static void OpGreaterThanOrEqual(ScriptVariable& b, ScriptVariable& a)
+{
+    b.greaterthanorequal(a);
+}
+
+static void OpLessThan(ScriptVariable& b, ScriptVariable& a)
+{
+    b.lessthan(a);
+}
+
+static void OpLessThanOrEqual(ScriptVariable& b, ScriptVariable& a)
+{
+    b.lessthanorequal(a);
+}
+
+static bool FastEquality(ScriptVariable& b, const ScriptVariable& a)
+{
+    return FastOpEquality(b, a, false);
+}
+
+static bool FastInequality(ScriptVariable& b, const ScriptVariable& a)
+{
+    return FastOpEquality(b, a, true);
+}
+
+struct testop_t {
+    const char *name;
+    fastop_t    fast;
+    op_t        op;
+    bool        shift;
+};
+
+static const testop_t ops[] = {
+    {"+",  FastOpPlus<ScriptVariable>,               OpPlus,               false},
+    {"-",  FastOpMinus<ScriptVariable>,              OpMinus,              false},
+    {"*",  FastOpMultiply<ScriptVariable>,           OpMultiply,           false},
+    {"/",  FastOpDivide<ScriptVariable>,             OpDivide,             false},
+    {"%",  FastOpPercentage<ScriptVariable>,         OpPercentage,         false},
+    {"&",  FastOpBitwiseAnd<ScriptVariable>,         OpBitwiseAnd,         false},
+    {"|",  FastOpBitwiseOr<ScriptVariable>,          OpBitwiseOr,          false},
+    {"^",  FastOpBitwiseExclOr<ScriptVariable>,      OpBitwiseExclOr,      false},
+    {"<<", FastOpShiftLeft<ScriptVariable>,          OpShiftLeft,          true },
+    {">>", FastOpShiftRight<ScriptVariable>,         OpShiftRight,         true },
+    {"==", FastEquality,                             OpEquality,           false},
+    {"!=", FastInequality,                           OpInequality,         false},
+    {">",  FastOpGreaterThan<ScriptVariable>,        OpGreaterThan,        false},
+    {">=", FastOpGreaterThanOrEqual<ScriptVariable>, OpGreaterThanOrEqual, false},
+    {"<",  FastOpLessThan<ScriptVariable>,           OpLessThan,           false},
+    {"<=", FastOpLessThanOrEqual<ScriptVariable>,    OpLessThanOrEqual,    false},
+};
+
+static const int   intSamples[]   = {0, 1, -1, 3, -7, 31, 65536, -1000000};
+static const float floatSamples[] = {0.0f, -0.0f, 1.0f, -1.5f, 0.00005f, 3.0f, 1e30f, NAN};
+
+static ScriptVariable samples[64];
+static int            numSamples;
+
+static void BuildSamples()
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(intSamples) / sizeof(intSamples[0]); i++) {
+        samples[numSamples++].setIntValue(intSamples[i]);
+    }
+
+    for (i = 0; i < sizeof(floatSamples) / sizeof(floatSamples[0]); i++) {
+        samples[numSamples++].setFloatValue(floatSamples[i]);
+    }
+
+    for (i = 0; i < sizeof(floatSamples) / sizeof(floatSamples[0]); i++) {
+        samples[numSamples++].setVectorValue(Vector(floatSamples[i], -floatSamples[i] * 0.25f, 2.0f));
+    }
+
+    // Types that are never handled by the fast paths
+    samples[numSamples++].Clear();
+    samples[numSamples++].setStringValue("3");
+    samples[numSamples++].setCharValue('a');
+}
+
+static bool SameResult(const ScriptVariable& fast, const ScriptVariable& var)
+{
+    if (fast.type != var.type) {
+        return false;
+    }
+
+    if (fast.type == VARIABLE_VECTOR) {
+        return !memcmp(fast.m_data.vectorValue, var.m_data.vectorValue, sizeof(float) * 3);
+    }
+
+    return !memcmp(&fast.m_data.intValue, &var.m_data.intValue, sizeof(int));
+}
+
+bool test_same_results()
+{
+    int    i, j;
+    size_t k;
+    int    numHandled;
+    int    numFallbacks;
+
+    BuildSamples();
+
+    numHandled   = 0;
+    numFallbacks = 0;
+
+    for (k = 0; k < sizeof(ops) / sizeof(ops[0]); k++) {
+        for (i = 0; i < numSamples; i++) {
+            for (j = 0; j < numSamples; j++) {
+                ScriptVariable fast = samples[i];
+                ScriptVariable var  = samples[i];
+                ScriptVariable a    = samples[j];
+
+                if (ops[k].shift && a.type == VARIABLE_INTEGER && (a.m_data.intValue < 0 || a.m_data.intValue > 31)) {
+                    // undefined for both
+                    continue;
+                }
+
+                if (!ops[k].fast(fast, a)) {
+                    numFallbacks++;
+                    continue;
+                }
+
+                try {
+                    ops[k].op(var, a);
+                } catch (const ScriptException& exc) {
+                    std::cerr << "Operator '" << ops[k].name << "' handled samples " << i << " and " << j
+                              << " that the ScriptVariable operator rejects: " << exc.string.c_str() << std::endl;
+                    return false;
+                }
+
+                if (!SameResult(fast, var)) {
+                    std::cerr << "Operator '" << ops[k].name << "' gives a different result for samples " << i
+                              << " and " << j << std::endl;
+                    return false;
+                }
+
+                numHandled++;
+            }
+        }
+    }
+
+    std::cout << "Checked " << numHandled << " operations, " << numFallbacks << " left to the operators"
+              << std::endl;
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (!test_same_results()) {
+        return 1;
+    }
+
+    return 0;
+}
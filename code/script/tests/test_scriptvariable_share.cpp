@@ -0,0 +1,361 @@
+/*
+===========================================================================
+Copyright (C) 2026 the OpenMoHAA team
+
+This file is part of OpenMoHAA source code.
+
+OpenMoHAA source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+OpenMoHAA source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenMoHAA source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+//
+// Checks that copies of string and const array variables share their payload,
+// that changing a copy doesn't change the other variables, and that values handed
+// to a thread through an event keep sharing it. Checks that variables sharing a string
+// are saved and loaded with their value. Measures the time taken to copy string variables.
+//
+
+#include "../../fgame/g_local.h"
+#include "../../fgame/archive.h"
+#include "../scriptvariable.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+
+//
+// Engine functions used by the script variables and the archiver
+//
+static std::map<std::string, std::string> files;
+
+static void *Test_Malloc(size_t size)
+{
+    return calloc(1, size);
+}
+
+static void Test_Free(void *ptr)
+{
+    free(ptr);
+}
+
+static void Test_Printf(const char *format, ...)
+{
+    va_list va;
+
+    va_start(va, format);
+    vprintf(format, va);
+    va_end(va);
+}
+
+static void Test_Error(int level, const char *format, ...)
+{
+    va_list va;
+
+    va_start(va, format);
+    vfprintf(stderr, format, va);
+    va_end(va);
+
+    exit(1);
+}
+
+// also called by the game objects destroyed at exit
+static cvar_t *Test_Cvar_Get(const char *varName, const char *varValue, int varFlags)
+{
+    static cvar_t cvar;
+    return &cvar;
+}
+
+static int Test_FS_WriteFile(const char *qpath, const void *buffer, int size)
+{
+    files[qpath] = std::string((const char *)buffer, size);
+    return size;
+}
+
+static long Test_FS_ReadFile(const char *qpath, void **buffer, qboolean quiet)
+{
+    auto it = files.find(qpath);
+
+    if (it == files.end()) {
+        *buffer = NULL;
+        return -1;
+    }
+
+    *buffer = malloc(it->second.size());
+    memcpy(*buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+static void Test_FS_FreeFile(void *buffer)
+{
+    free(buffer);
+}
+
+static const int NUM_COPIES = 1000000;
+
+#define CHECK(condition)                                                     \
+    if (!(condition)) {                                                      \
+        std::cerr << __FUNCTION__ << ": failed " << #condition << std::endl; \
+        return false;                                                        \
+    }
+
+bool test_string_copies()
+{
+    ScriptVariable original;
+    ScriptVariable value;
+
+    original.setStringValue("a long enough string to be worth sharing");
+
+    ScriptVariable copy(original);
+    CHECK(copy.m_data.stringValue == original.m_data.stringValue);
+    CHECK(original.m_data.stringValue->refCount == 1);
+
+    ScriptVariable assigned;
+    assigned.setIntValue(1);
+    assigned = original;
+    CHECK(assigned.m_data.stringValue == original.m_data.stringValue);
+    CHECK(original.m_data.stringValue->refCount == 2);
+
+    // a string variable assigned another string drops the former one
+    ScriptVariable other;
+    other.setStringValue("other");
+    other = original;
+    CHECK(other.m_data.stringValue == original.m_data.stringValue);
+    CHECK(original.m_data.stringValue->refCount == 3);
+
+    // changing a copy must not change the others
+    copy.setStringValue("changed");
+    CHECK(copy.stringValue() == "changed");
+    CHECK(original.stringValue() == "a long enough string to be worth sharing");
+    CHECK(original.m_data.stringValue->refCount == 2);
+
+    value.setIntValue(5);
+    assigned += value;
+    CHECK(assigned.stringValue() == "a long enough string to be worth sharing5");
+    CHECK(original.stringValue() == "a long enough string to be worth sharing");
+    CHECK(original.m_data.stringValue->refCount == 1);
+
+    other.setIntValue(3);
+    CHECK(original.m_data.stringValue->refCount == 0);
+
+    // a string that isn't shared is changed in place
+    ScriptStringHolder *holder = copy.m_data.stringValue;
+    copy.setStringValue("changed again");
+    CHECK(copy.m_data.stringValue == holder);
+    CHECK(copy.stringValue() == "changed again");
+
+    return true;
+}
+
+bool test_const_array_copies()
+{
+    ScriptVariable elements[3];
+
+    elements[0].setStringValue("first");
+    elements[1].setIntValue(2);
+    elements[2].setStringValue("third");
+
+    ScriptVariable array;
+    array.setConstArrayValue(elements, 3);
+
+    // elements are copied from the stack when the array is built, strings are shared
+    CHECK(array[1]->m_data.stringValue == elements[0].m_data.stringValue);
+    CHECK(array[3]->m_data.stringValue == elements[2].m_data.stringValue);
+
+    ScriptVariable copy(array);
+    CHECK(copy.m_data.constArrayValue == array.m_data.constArrayValue);
+    CHECK(array.m_data.constArrayValue->refCount == 1);
+
+    CHECK(copy[1]->stringValue() == "first");
+    CHECK(copy[2]->intValue() == 2);
+
+    copy.Clear();
+    CHECK(array.m_data.constArrayValue->refCount == 0);
+
+    return true;
+}
+
+bool test_event_handoff()
+{
+    ScriptVariable  text;
+    ScriptVariable  elements[2];
+    ScriptVariable  array;
+    ScriptVariable  received;
+    ScriptVariable *values;
+    int             i;
+
+    text.setStringValue("handed to the thread");
+    elements[0] = text;
+    elements[1].setFloatValue(1.5f);
+    array.setConstArrayValue(elements, 2);
+
+    // the caller builds the event, the thread gets a copy of it
+    Event *ev = new Event();
+    ev->AddValue(text);
+    ev->AddValue(array);
+
+    Event threadEvent(*ev);
+    delete ev;
+
+    CHECK(threadEvent.NumArgs() == 2);
+    CHECK(threadEvent.GetValue(1).m_data.stringValue == text.m_data.stringValue);
+    CHECK(threadEvent.GetValue(2).m_data.constArrayValue == array.m_data.constArrayValue);
+
+    // the thread copies its parameters into local variables
+    values = new ScriptVariable[threadEvent.NumArgs()];
+    for (i = 0; i < threadEvent.NumArgs(); i++) {
+        values[i] = threadEvent.GetValue(i + 1);
+    }
+
+    CHECK(values[0].m_data.stringValue == text.m_data.stringValue);
+    CHECK(values[1][1]->stringValue() == "handed to the thread");
+
+    // the thread changing its copy doesn't change the caller's variable
+    values[0].setStringValue("changed by the thread");
+    CHECK(text.stringValue() == "handed to the thread");
+    CHECK(threadEvent.GetValue(1).stringValue() == "handed to the thread");
+
+    delete[] values;
+
+    received = threadEvent.GetValue(1);
+    threadEvent.Clear();
+
+    CHECK(received.stringValue() == "handed to the thread");
+    CHECK(received.m_data.stringValue == text.m_data.stringValue);
+
+    return true;
+}
+
+bool test_archive()
+{
+    Archiver       save;
+    Archiver       load;
+    ScriptVariable original;
+    ScriptVariable copies[2];
+    ScriptVariable loaded[3];
+    int            i;
+
+    original.setStringValue("a string shared by the saved variables");
+    copies[0] = original;
+    copies[1] = original;
+    CHECK(original.m_data.stringValue->refCount == 2);
+
+    CHECK(save.Create("shared.sav", qfalse));
+    original.ArchiveInternal(save);
+    copies[0].ArchiveInternal(save);
+    copies[1].ArchiveInternal(save);
+    save.Close();
+    CHECK(save.NoErrors());
+
+    // saving leaves the variables sharing their string
+    CHECK(copies[0].m_data.stringValue == original.m_data.stringValue);
+    CHECK(original.m_data.stringValue->refCount == 2);
+
+    CHECK(load.Read("shared.sav", qfalse));
+    for (i = 0; i < 3; i++) {
+        loaded[i].ArchiveInternal(load);
+    }
+    load.Close();
+    CHECK(load.NoErrors());
+
+    for (i = 0; i < 3; i++) {
+        CHECK(loaded[i].GetType() == VARIABLE_STRING);
+        CHECK(loaded[i].stringValue() == "a string shared by the saved variables");
+        CHECK(loaded[i].m_data.stringValue != original.m_data.stringValue);
+    }
+
+    // changing a loaded variable must not change the others
+    loaded[1].setStringValue("changed after loading");
+    CHECK(loaded[0].stringValue() == "a string shared by the saved variables");
+    CHECK(loaded[1].stringValue() == "changed after loading");
+    CHECK(loaded[2].stringValue() == "a string shared by the saved variables");
+    CHECK(original.stringValue() == "a string shared by the saved variables");
+
+    loaded[1] = loaded[0];
+    loaded[0].setStringValue("changed again");
+    CHECK(loaded[1].stringValue() == "a string shared by the saved variables");
+    CHECK(loaded[2].stringValue() == "a string shared by the saved variables");
+
+    return true;
+}
+
+bool test_benchmark()
+{
+    ScriptVariable  original;
+    ScriptVariable *copies;
+    int             i;
+
+    original.setStringValue("a string copied to many variables");
+    copies = new ScriptVariable[NUM_COPIES];
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (i = 0; i < NUM_COPIES; i++) {
+        copies[i] = original;
+    }
+
+    for (i = 0; i < NUM_COPIES; i++) {
+        copies[i].Clear();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Copied and cleared " << NUM_COPIES << " string variables in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us" << std::endl;
+
+    delete[] copies;
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    gi.Malloc       = Test_Malloc;
+    gi.Free         = Test_Free;
+    gi.Printf       = Test_Printf;
+    gi.DPrintf      = Test_Printf;
+    gi.DPrintf2     = Test_Printf;
+    gi.Error        = Test_Error;
+    gi.Cvar_Get     = Test_Cvar_Get;
+    gi.FS_WriteFile = Test_FS_WriteFile;
+    gi.FS_ReadFile  = Test_FS_ReadFile;
+    gi.FS_FreeFile  = Test_FS_FreeFile;
+
+    if (!test_string_copies()) {
+        return 1;
+    }
+
+    if (!test_const_array_copies()) {
+        return 1;
+    }
+
+    if (!test_event_handoff()) {
+        return 1;
+    }
+
+    if (!test_archive()) {
+        return 1;
+    }
+
+    if (!test_benchmark()) {
+        return 1;
+    }
+
+    return 0;
+}
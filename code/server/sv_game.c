@@ -1952,6 +1952,7 @@ void SV_InitGameProgs( void ) {
     
     import.Client_NumPendingCommands	= PF_SV_Client_NumPendingCommands;
     import.Client_MaxPendingCommands	= PF_SV_Client_MaxPendingCommands;
+    import.FS_Rename					= FS_Rename_HomeData;
 
 	ge = Sys_GetGameAPI( &import );
 